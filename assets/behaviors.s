@@ -0,0 +1,85 @@
+# Comportements des ennemis, assemblés par tools/behavior_asm (make behaviors) puis placés dans le bundle.
+# Syntaxe et registres : voir tools/behavior_asm.c et src/behavior.h. Un programme par type d'ennemi (bind).
+
+# Formation d'origine : pas de la formation, tir aléatoire
+program formation
+    add x, x, dx
+    roll t0
+    jge t0, chance, done
+    fire
+done:
+
+# Tireurs : ne tirent qu'alignés avec le joueur, mais bien plus souvent
+program aimed
+    add x, x, dx
+    sub t0, x, px               # Écart entre les centres : (x + 15) - (px + 20)
+    add t0, t0, -5
+    abs t0, t0
+    jge t0, 60, done
+    roll t1
+    mul t2, chance, 6
+    jge t1, t2, done
+    fire
+done:
+
+# Zigzag : oscille de +/- 24 px autour de sa place dans la formation (p0 : décalage, p1 : 1 vers la gauche)
+program zigzag
+    mov t0, p0
+    jge p1, 1, left
+    add p0, p0, 1.5
+    jlt p0, 24, move
+    mov p1, 1
+    jmp move
+left:
+    sub p0, p0, 1.5
+    jge p0, -24, move
+    mov p1, 0
+move:
+    sub t1, p0, t0
+    add x, x, dx
+    add x, x, t1
+    roll t2
+    jge t2, chance, done
+    fire
+done:
+
+# Bombardier : quitte parfois la formation en piqué, tire en descendant puis remonte à sa place
+# (p0 : profondeur du piqué, p1 : vitesse verticale, nulle en formation)
+program dive
+    add x, x, dx
+    jlt 0, p1, moving
+    jlt p1, 0, moving
+    roll t0
+    jge t0, 4, shoot            # Départ en piqué : 4 chances sur 2000 par tick
+    mov p1, 5
+    jmp done
+moving:
+    add y, y, p1
+    add p0, p0, p1
+    jge p0, 120, bottom
+    jlt y, 400, climbing        # Jamais assez bas pour atteindre la ligne du joueur
+bottom:
+    mov p1, -2
+climbing:
+    jlt 0, p0, dive_fire
+    sub y, y, p0                # De retour dans la formation
+    mov p0, 0
+    mov p1, 0
+    jmp done
+dive_fire:
+    roll t0
+    mul t1, chance, 3
+    jge t0, t1, done
+    fire
+    jmp done
+shoot:
+    roll t0
+    jge t0, chance, done
+    fire
+done:
+
+bind 0 formation
+bind 1 formation
+bind 2 aimed
+bind 3 zigzag
+bind 4 dive
@@ -0,0 +1,417 @@
+/**
+ * @file bench.c
+ * @brief Suite de benchmarks (make bench) : simulation, rendu logiciel, rasteriseur, sauvegardes et mixage audio.
+ * @details Scénarios à graine fixe. Chaque mesure est répétée BENCH_REPEATS fois et la plus rapide (ns/op,
+ *          la moins perturbée par le reste de la machine) est écrite en JSON, comparée ensuite par
+ *          bench/compare.py à la référence locale produite par make bench-baseline.
+ *          Usage : bench [sortie.json]
+ */
+
+#define _POSIX_C_SOURCE 199309L
+#include <SDL3/SDL.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "model.h"
+#include "view_sdl.h"
+#include "audio.h"
+#include "raster.h"
+#include "snapshot_arena.h"
+#include "rewind.h"
+#include "replay.h"
+#include "highscore.h"
+#include "behavior.h"
+#include "bundle.h"
+
+#define BENCH_SEED 12345
+#define BENCH_REPEATS 5
+#define BENCH_SAVE_SLOT 99      // Slot dédié : ne touche pas aux sauvegardes du joueur
+#define TICKS_PER_RESTORE 100   // L'état est restauré avant que la formation n'atteigne le joueur
+
+typedef struct { char name[64]; double ns_per_op; long iterations; } BenchResult;
+
+static BenchResult results[64];
+static int result_count = 0;
+
+static double now_ns() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void record(const char* name, double samples[BENCH_REPEATS], long iterations) {
+    BenchResult* r = &results[result_count++];
+    snprintf(r->name, sizeof(r->name), "%s", name);
+    r->ns_per_op = samples[0];
+    for (int i = 1; i < BENCH_REPEATS; i++) if (samples[i] < r->ns_per_op) r->ns_per_op = samples[i];
+    r->iterations = iterations;
+    printf("  %-32s %12.1f ns/op\n", name, r->ns_per_op);
+}
+
+/**
+ * @brief État de départ pour une densité donnée : `enemies` ennemis en grille, tous les tirs actifs.
+ */
+static void make_scenario(GameState* s, int enemies) {
+    memset(s, 0, sizeof(*s));
+    model_seed(s, BENCH_SEED);
+    model_new_game(s, NULL);
+    s->lives = 1000000; // La partie ne doit pas s'arrêter pendant la mesure
+    s->enemy_count = enemies;
+    for (int i = 0; i < enemies; i++) {
+        s->enemies[i].type = i % 2;
+        s->enemies[i].alive = 1;
+        s->enemies[i].pos.x = 40 + (i % 10) * 60;
+        s->enemies[i].pos.y = 50 + (i / 10) * 40;
+    }
+    for (int i = 0; i < MAX_SHOTS; i++) {
+        s->shots[i].active = 1;
+        s->shots[i].pos.x = 50 + i * 90;
+        s->shots[i].pos.y = GAME_HEIGHT - 100 - i * 30;
+    }
+}
+
+static void bench_model_update(int enemies, long iterations) {
+    GameState template_state, s;
+    make_scenario(&template_state, enemies);
+    double samples[BENCH_REPEATS];
+    for (int r = 0; r < BENCH_REPEATS; r++) {
+        double t0 = now_ns();
+        for (long i = 0; i < iterations; i++) {
+            if (i % TICKS_PER_RESTORE == 0) s = template_state;
+            model_update(&s);
+            model_clear_events(&s);
+        }
+        samples[r] = (now_ns() - t0) / iterations;
+    }
+    char name[64];
+    snprintf(name, sizeof(name), "model_update/enemies_%d", enemies);
+    record(name, samples, iterations);
+}
+
+static void bench_spawn_wave(long iterations) {
+    GameState s;
+    make_scenario(&s, 0);
+    double samples[BENCH_REPEATS];
+    for (int r = 0; r < BENCH_REPEATS; r++) {
+        double t0 = now_ns();
+        for (long i = 0; i < iterations; i++) spawn_wave(&s);
+        samples[r] = (now_ns() - t0) / iterations;
+    }
+    record("spawn_wave", samples, iterations);
+}
+
+static void bench_check_collision(long iterations) {
+    // Positions pseudo-aléatoires pré-calculées : mélange de hits et de miss
+    enum { N = 1024 };
+    static float xs[N], ys[N];
+    srand(BENCH_SEED);
+    for (int i = 0; i < N; i++) { xs[i] = rand() % GAME_WIDTH; ys[i] = rand() % GAME_HEIGHT; }
+    double samples[BENCH_REPEATS];
+    volatile int hits = 0;
+    for (int r = 0; r < BENCH_REPEATS; r++) {
+        int h = 0;
+        double t0 = now_ns();
+        for (long i = 0; i < iterations; i++) {
+            int a = i & (N - 1), b = (i * 7 + 3) & (N - 1);
+            h += check_collision(xs[a], ys[a], 4, 10, xs[b], ys[b], 300, 200);
+        }
+        samples[r] = (now_ns() - t0) / iterations;
+        hits += h;
+    }
+    record("check_collision", samples, iterations);
+}
+
+// Barrière de compilation : la copie vers *p est réputée lue, elle ne peut pas être éliminée
+#define BENCH_SINK(p) __asm__ volatile("" :: "r"(p) : "memory")
+
+/**
+ * @brief Même travail partout : cloner s dans copy, directement ou via un instantané (deux copies).
+ * @details Avec l'arène, les 4096 instantanés d'une décision (20 Mo) ne tiennent pas en cache : la mesure
+ *          inclut ces défauts de cache, contrairement aux deux premières où tout reste en cache L1.
+ */
+static void bench_snapshot(long iterations) {
+    GameState s, copy;
+    make_scenario(&s, 30);
+    SnapshotArena arena;
+    if (!snapshot_arena_init(&arena, 4096)) return;
+    double samples[BENCH_REPEATS];
+
+    for (int r = 0; r < BENCH_REPEATS; r++) {
+        double t0 = now_ns();
+        for (long i = 0; i < iterations; i++) { copy = s; BENCH_SINK(&copy); }
+        samples[r] = (now_ns() - t0) / iterations;
+    }
+    record("clone/gamestate_copy", samples, iterations);
+
+    ModelSnapshot snap;
+    for (int r = 0; r < BENCH_REPEATS; r++) {
+        double t0 = now_ns();
+        for (long i = 0; i < iterations; i++) { model_snapshot(&s, &snap); model_restore(&copy, &snap); BENCH_SINK(&copy); }
+        samples[r] = (now_ns() - t0) / iterations;
+    }
+    record("clone/snapshot_restore", samples, iterations);
+
+    // Une décision : 4096 instantanés pris puis rendus d'un coup
+    for (int r = 0; r < BENCH_REPEATS; r++) {
+        double t0 = now_ns();
+        for (long i = 0; i < iterations; i++) {
+            if (i % 4096 == 0) snapshot_arena_reset(&arena);
+            ModelSnapshot* slot = snapshot_arena_alloc(&arena);
+            model_snapshot(&s, slot);
+            model_restore(&copy, slot);
+            BENCH_SINK(&copy);
+        }
+        samples[r] = (now_ns() - t0) / iterations;
+    }
+    record("clone/snapshot_restore_arena", samples, iterations);
+    snapshot_arena_destroy(&arena);
+}
+
+static void bench_rewind(long iterations) {
+    GameState s;
+    make_scenario(&s, 30);
+    RewindBuffer rb;
+    if (!rewind_init(&rb, REWIND_SECONDS * REWIND_TICKS_PER_SECOND, REWIND_KEYFRAME_INTERVAL)) return;
+    double samples[BENCH_REPEATS];
+
+    // Coût ajouté à chaque tick de jeu (hors model_tick)
+    for (int r = 0; r < BENCH_REPEATS; r++) {
+        double t0 = now_ns();
+        for (long i = 0; i < iterations; i++) { rewind_record(&rb, &s, (InputType)(i & 3)); s.score += (int)(i & 1); }
+        samples[r] = (now_ns() - t0) / iterations;
+    }
+    record("rewind/record_tick", samples, iterations);
+
+    // Un tick en arrière : image clé + re-simulation ; le tampon est rempli par de vrais ticks hors mesure
+    long steps = iterations / 100;
+    for (int r = 0; r < BENCH_REPEATS; r++) {
+        double total = 0;
+        for (long done = 0; done < steps;) {
+            make_scenario(&s, 30);
+            rewind_clear(&rb);
+            for (int t = 0; t < rb.capacity; t++) { rewind_record(&rb, &s, (InputType)(t & 3)); model_tick(&s); model_clear_events(&s); }
+            double t0 = now_ns();
+            while (done < steps && rewind_step_back(&rb, &s)) done++;
+            total += now_ns() - t0;
+        }
+        samples[r] = total / steps;
+    }
+    record("rewind/step_back", samples, steps);
+    rewind_destroy(&rb);
+}
+
+static void bench_replay(long iterations) {
+    const char* path = "bench_replay.tmp";
+    GameState s = {0};
+    model_new_game(&s, NULL);
+    replay_start_state(&s, 12345, s.settings.player_speed);
+    ReplayWriter* w = replay_writer_create(12345, s.settings.player_speed, REPLAY_KEYFRAME_INTERVAL);
+    if (!w) return;
+    srand(12345);
+    InputType input = INPUT_NONE;
+    int ticks = 0;
+    for (; ticks < 6000 && !s.game_over; ticks++) {
+        if (rand() % 20 == 0) input = (InputType)(rand() % 4);
+        replay_writer_record(w, &s, input);
+        replay_apply_input(&s, input);
+        model_tick(&s);
+        model_clear_events(&s);
+    }
+    int saved = replay_writer_save(w, &s, path);
+    replay_writer_destroy(w);
+    Replay* replay = saved ? replay_open(path) : NULL;
+    remove(path);
+    if (!replay) return;
+
+    // Accès à un tick quelconque : image clé indexée + au plus REPLAY_KEYFRAME_INTERVAL - 1 ticks re-simulés
+    double samples[BENCH_REPEATS];
+    ReplayCursor cursor;
+    for (int r = 0; r < BENCH_REPEATS; r++) {
+        double t0 = now_ns();
+        for (long i = 0; i < iterations; i++) replay_seek(replay, (uint64_t)rand() % ticks, &s, &cursor);
+        samples[r] = (now_ns() - t0) / iterations;
+    }
+    record("replay/seek_random", samples, iterations);
+    replay_close(replay);
+}
+
+static void bench_highscore(long iterations) {
+    const char* path = "bench_highscores.tmp";
+    remove(path);
+    HighScoreTable* table = highscore_open(path);
+    if (!table) return;
+    srand(12345);
+    HighScore entry;
+    for (int i = 0; i < 100000; i++) { highscore_entry(&entry, rand() % 1000000, 1, "bench"); highscore_insert(table, &entry); }
+
+    // Tableau de 100 000 scores : insertion (verrou, deux dichotomies, décalage d'une page) puis rang
+    double samples[BENCH_REPEATS];
+    for (int r = 0; r < BENCH_REPEATS; r++) {
+        double t0 = now_ns();
+        for (long i = 0; i < iterations; i++) { entry.score = rand() % 1000000; highscore_insert(table, &entry); }
+        samples[r] = (now_ns() - t0) / iterations;
+    }
+    record("highscore/insert_100k", samples, iterations);
+
+    for (int r = 0; r < BENCH_REPEATS; r++) {
+        double t0 = now_ns();
+        for (long i = 0; i < iterations; i++) highscore_rank(table, rand() % 1000000);
+        samples[r] = (now_ns() - t0) / iterations;
+    }
+    record("highscore/rank_100k", samples, iterations);
+    highscore_close(table);
+    remove(path);
+}
+
+static void bench_render(long iterations) {
+    if (!view_sdl_init_headless(GAME_WIDTH, GAME_HEIGHT)) {
+        printf("  render : renderer logiciel indisponible (%s)\n", SDL_GetError());
+        return;
+    }
+    GameState s;
+    make_scenario(&s, 50);
+    double samples[BENCH_REPEATS];
+    for (int r = 0; r < BENCH_REPEATS; r++) {
+        double t0 = now_ns();
+        for (long i = 0; i < iterations; i++) view_sdl_render(&s, 0, 0);
+        samples[r] = (now_ns() - t0) / iterations;
+    }
+    record("view_sdl_render/software", samples, iterations);
+    view_sdl_shutdown();
+}
+
+static void bench_raster(RasterFormat format, int size, long iterations) {
+    Raster* r = raster_create(size, size, format);
+    if (!r) return;
+    unsigned char* frame = malloc(raster_frame_size(r));
+    GameState s;
+    make_scenario(&s, 50);
+    double samples[BENCH_REPEATS];
+    for (int rep = 0; rep < BENCH_REPEATS; rep++) {
+        double t0 = now_ns();
+        for (long i = 0; i < iterations; i++) raster_draw(r, &s, frame);
+        samples[rep] = (now_ns() - t0) / iterations;
+    }
+    char name[64];
+    snprintf(name, sizeof(name), "raster_draw/%s_%dx%d", format == RASTER_GRAY ? "gray" : "rgb", size, size);
+    record(name, samples, iterations);
+    free(frame);
+    raster_destroy(r);
+}
+
+static void bench_save_load(long iterations) {
+    model_init_save_system();
+    GameState s, loaded;
+    make_scenario(&s, 30);
+    double samples[BENCH_REPEATS];
+    for (int r = 0; r < BENCH_REPEATS; r++) {
+        double t0 = now_ns();
+        for (long i = 0; i < iterations; i++) {
+            model_save_slot(&s, BENCH_SAVE_SLOT);
+            model_load_slot(&loaded, BENCH_SAVE_SLOT);
+        }
+        samples[r] = (now_ns() - t0) / iterations;
+    }
+    record("save_load_roundtrip", samples, iterations);
+    char path[64];
+    snprintf(path, sizeof(path), "saves/save_%d.bin", BENCH_SAVE_SLOT);
+    remove(path);
+}
+
+static void bench_audio_mix(long iterations) {
+    SDL_SetHint(SDL_HINT_AUDIO_DRIVER, "dummy");
+    if (!audio_init()) {
+        printf("  audio : initialisation impossible (%s)\n", SDL_GetError());
+        return;
+    }
+    audio_pause(); // Le callback ne consomme plus : le benchmark est l'unique lecteur de la file
+    enum { CHUNK = 1024 }; // 512 frames stéréo
+    static float out[CHUNK];
+    double samples[BENCH_REPEATS];
+    for (int r = 0; r < BENCH_REPEATS; r++) {
+        double t0 = now_ns();
+        for (long i = 0; i < iterations; i++) {
+            if (i % 8 == 0) {
+                audio_play(SOUND_SHOOT);
+                audio_play(SOUND_ENEMY_DIE);
+            }
+            audio_mix(out, CHUNK);
+        }
+        samples[r] = (now_ns() - t0) / iterations;
+    }
+    record("audio_mix/512_frames", samples, iterations);
+    audio_shutdown();
+}
+
+/**
+ * @brief 10 000 ennemis scriptés (programmes du bundle, sinon programme intégré) : un tick complet,
+ *        regroupement par programme compris, doit tenir largement dans les 16,7 ms d'une image à 60 Hz.
+ */
+static void bench_behaviors(long iterations) {
+    enum { N = 10000 };
+    static Enemy enemies[N];
+    static int order[N];
+    size_t size = 0;
+    const void* table = bundle_get(BEHAVIOR_FILE, &size);
+    if (table && !behavior_set(table, size)) printf("  comportements du bundle invalides : programme intégré\n");
+    GameState s;
+    make_scenario(&s, 0);
+    uint32_t shot_chance[WAVES_MAX_TYPES];
+    for (int t = 0; t < WAVES_MAX_TYPES; t++) shot_chance[t] = (uint32_t)(s.rules.enemy_shot_chance * waves_type(t)->fire_scale);
+    BehaviorContext ctx = { &s, s.rules.enemy_speed, shot_chance };
+    double samples[BENCH_REPEATS];
+    for (int r = 0; r < BENCH_REPEATS; r++) {
+        for (int i = 0; i < N; i++) enemies[i] = (Enemy){ { 40 + (i % 100) * 9, 50 + (i / 100) * 3 }, i % 5, 1, { 0 } };
+        double t0 = now_ns();
+        for (long it = 0; it < iterations; it++) {
+            behavior_run_all(&ctx, enemies, N, order); // Chemin de model_update
+            for (int k = 0; k < MAX_ENEMY_SHOTS; k++) s.enemy_shots[k].active = 0; // Les tirs partent dans le jeu
+        }
+        samples[r] = (now_ns() - t0) / iterations;
+    }
+    record("behavior/10k_enemies_tick", samples, iterations);
+    behavior_set(NULL, 0);
+}
+
+static int write_json(const char* path) {
+    FILE* f = fopen(path, "w");
+    if (!f) return 0;
+    fprintf(f, "{\n  \"version\": 1,\n  \"seed\": %d,\n  \"results\": [\n", BENCH_SEED);
+    for (int i = 0; i < result_count; i++) {
+        fprintf(f, "    {\"name\": \"%s\", \"ns_per_op\": %.2f, \"iterations\": %ld}%s\n",
+                results[i].name, results[i].ns_per_op, results[i].iterations, i + 1 < result_count ? "," : "");
+    }
+    fprintf(f, "  ]\n}\n");
+    fclose(f);
+    return 1;
+}
+
+int main(int argc, char* argv[]) {
+    const char* out = argc > 1 ? argv[1] : "bench_results.json";
+
+    printf("--- Benchmarks (graine %d, minimum de %d) ---\n", BENCH_SEED, BENCH_REPEATS);
+    bench_model_update(10, 200000);
+    bench_model_update(30, 200000);
+    bench_model_update(50, 200000);
+    bench_spawn_wave(1000000);
+    bench_check_collision(10000000);
+    bench_snapshot(1000000);
+    bench_rewind(1000000);
+    bench_replay(2000);
+    bench_highscore(20000);
+    bench_render(200);
+    bench_raster(RASTER_GRAY, 84, 200000);
+    bench_raster(RASTER_RGB, 84, 200000);
+    bench_save_load(2000);
+    bench_audio_mix(20000);
+    bench_behaviors(2000);
+    SDL_Quit();
+
+    if (!write_json(out)) {
+        fprintf(stderr, "Impossible d'écrire %s\n", out);
+        return 1;
+    }
+    printf("Résultats écrits dans %s\n", out);
+    return 0;
+}
@@ -0,0 +1,56 @@
+#!/usr/bin/env python3
+"""Compare des résultats de benchmark à une référence et signale les régressions.
+
+Usage : compare.py baseline.json results.json [--threshold 0.25] [--strict]
+La référence n'a de sens que sur la machine qui l'a produite (make bench-baseline) : les régressions
+sont signalées, et ne font échouer la commande (code de retour 1) qu'avec --strict.
+"""
+
+import argparse
+import json
+import sys
+
+
+def load(path):
+    with open(path) as f:
+        return {r["name"]: r["ns_per_op"] for r in json.load(f)["results"]}
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("baseline")
+    parser.add_argument("results")
+    parser.add_argument("--threshold", type=float, default=0.25,
+                        help="écart relatif toléré avant de signaler une régression (défaut : 0.25)")
+    parser.add_argument("--strict", action="store_true",
+                        help="code de retour 1 en cas de régression (sinon rapport seul)")
+    args = parser.parse_args()
+
+    baseline = load(args.baseline)
+    results = load(args.results)
+    regressions = 0
+
+    print(f"{'benchmark':34} {'référence':>12} {'actuel':>12} {'écart':>8}")
+    for name, current in results.items():
+        ref = baseline.get(name)
+        if ref is None:
+            print(f"{name:34} {'-':>12} {current:12.1f} {'nouveau':>8}")
+            continue
+        delta = (current - ref) / ref if ref > 0 else 0.0
+        flag = ""
+        if delta > args.threshold:
+            flag = "  REGRESSION"
+            regressions += 1
+        print(f"{name:34} {ref:12.1f} {current:12.1f} {delta:+7.1%}{flag}")
+    for name in baseline.keys() - results.keys():
+        print(f"{name:34} absent des résultats")
+
+    if regressions:
+        print(f"{regressions} régression(s) au-delà de {args.threshold:.0%}")
+        return 1 if args.strict else 0
+    print("Aucune régression.")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -1,40 +1,198 @@
 /**
  * @file audio.c
  * @brief Moteur audio utilisant SDL3 Audio Stream.
- * @details Gère le chargement WAV, la conversion de format et le mixage anti-lag.
+ * @details Gère le chargement WAV, la conversion au format de mixage et un mixeur multi-voix
+ * (pool fixe de voix sommées dans le callback audio, gain par voix et vol de voix).
+ * Le thread de jeu ne touche jamais aux voix : il dépose ses demandes dans une file SPSC lock-free.
  */
 
 #include <SDL3/SDL.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
 #include "audio.h"
+#include "timings.h"
+#include "audio_cache.h"
+#include "bundle.h"
+
+#if defined(__SSE__) || defined(_M_X64)
+    #include <xmmintrin.h>
+    #define AUDIO_USE_SSE 1
+#endif
+
+// Format interne de mixage : float stéréo, SDL convertit ensuite vers le périphérique
+#define MIX_FREQ 48000
+#define MIX_CHANNELS 2
+#define MIX_CHUNK_FRAMES 512
+#define MAX_VOICES 16
+#define SOUND_COUNT 4
+#define COMMAND_QUEUE_SIZE 256 // Puissance de 2
+
+typedef struct {
+    const float* data;  // Échantillons entrelacés du son joué (NULL : voix libre)
+    int length;         // Longueur totale en floats
+    int position;       // Position de lecture en floats
+    float gain;
+    Uint32 start_order; // Ordre de démarrage (pour voler la voix la plus ancienne)
+} Voice;
 
 static SDL_AudioStream *stream = NULL;
-static Uint8 *wav_buffers[3] = {NULL, NULL, NULL}; 
-static Uint32 wav_lengths[3] = {0, 0, 0}; 
+static const float *wav_buffers[SOUND_COUNT] = {NULL, NULL, NULL, NULL};
+static int wav_lengths[SOUND_COUNT] = {0, 0, 0, 0}; // En floats
+static AudioCacheMapping wav_mappings[SOUND_COUNT]; // Non vide si le son vient du cache (mmap)
 static int is_audio_initialized = 0;
 
-// Seuil de lag (44100Hz * 2 channels * 2 bytes * 0.1s)
-// Si le buffer contient plus que ça, on ignore les nouveaux sons pour éviter le retard.
-#define MAX_AUDIO_LAG 17640
+static const SDL_AudioSpec mix_spec = { SDL_AUDIO_F32, MIX_CHANNELS, MIX_FREQ };
+static Voice voices[MAX_VOICES];
+static Uint32 voice_counter = 0;
+static float mix_buffer[MIX_CHUNK_FRAMES * MIX_CHANNELS];
+
+// File SPSC : producteur = thread de jeu (audio_play), consommateur = callback audio
+typedef struct { int sound; float gain; } PlayCommand;
+static PlayCommand commands[COMMAND_QUEUE_SIZE];
+static atomic_uint command_head = 0; // Écrit par le producteur
+static atomic_uint command_tail = 0; // Écrit par le consommateur
+static atomic_int active_voices = 0;  // Publié par le callback pour l'overlay
+
+/**
+ * @brief Ajoute src * gain dans dst (SSE si disponible).
+ */
+static void mix_add(float* dst, const float* src, int count, float gain) {
+    int i = 0;
+#ifdef AUDIO_USE_SSE
+    __m128 g = _mm_set1_ps(gain);
+    for (; i + 4 <= count; i += 4) {
+        __m128 d = _mm_loadu_ps(dst + i);
+        __m128 s = _mm_loadu_ps(src + i);
+        _mm_storeu_ps(dst + i, _mm_add_ps(d, _mm_mul_ps(s, g)));
+    }
+#endif
+    for (; i < count; i++) dst[i] += src[i] * gain;
+}
+
+/**
+ * @brief Écrête le mix dans [-1, 1] pour éviter la saturation quand plusieurs voix se superposent.
+ */
+static void mix_clip(float* buf, int count) {
+    int i = 0;
+#ifdef AUDIO_USE_SSE
+    __m128 lo = _mm_set1_ps(-1.0f), hi = _mm_set1_ps(1.0f);
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_ps(buf + i, _mm_min_ps(_mm_max_ps(_mm_loadu_ps(buf + i), lo), hi));
+    }
+#endif
+    for (; i < count; i++) {
+        if (buf[i] < -1.0f) buf[i] = -1.0f;
+        else if (buf[i] > 1.0f) buf[i] = 1.0f;
+    }
+}
 
 /**
- * @brief Charge un fichier WAV et le convertit au format du périphérique audio.
+ * @brief Démarre une voix (thread audio uniquement), en volant la plus ancienne si le pool est plein.
  */
-void load_sound(int index, const char* path) {
+static void start_voice(int index, float gain) {
+    if (!wav_buffers[index] || wav_lengths[index] <= 0) return;
+    int slot = -1;
+    for (int v = 0; v < MAX_VOICES; v++) {
+        if (!voices[v].data) { slot = v; break; }
+    }
+    if (slot == -1) {
+        slot = 0;
+        for (int v = 1; v < MAX_VOICES; v++) {
+            if ((Sint32)(voices[v].start_order - voices[slot].start_order) < 0) slot = v;
+        }
+    }
+    voices[slot].data = wav_buffers[index];
+    voices[slot].length = wav_lengths[index];
+    voices[slot].position = 0;
+    voices[slot].gain = gain;
+    voices[slot].start_order = voice_counter++;
+}
+
+/**
+ * @brief Vide la file de commandes et démarre les voix demandées (thread audio).
+ */
+static void drain_commands() {
+    unsigned tail = atomic_load_explicit(&command_tail, memory_order_relaxed);
+    unsigned head = atomic_load_explicit(&command_head, memory_order_acquire);
+    while (tail != head) {
+        PlayCommand* cmd = &commands[tail & (COMMAND_QUEUE_SIZE - 1)];
+        start_voice(cmd->sound, cmd->gain);
+        tail++;
+    }
+    atomic_store_explicit(&command_tail, tail, memory_order_release);
+}
+
+/**
+ * @brief Remplit out (count floats entrelacés) avec la somme des voix actives, après lecture de la file.
+ */
+void audio_mix(float* out, int count) {
+    drain_commands();
+    memset(out, 0, count * sizeof(float));
+
+    for (int v = 0; v < MAX_VOICES; v++) {
+        Voice* voice = &voices[v];
+        if (!voice->data) continue;
+        int n = voice->length - voice->position;
+        if (n > count) n = count;
+        mix_add(out, voice->data + voice->position, n, voice->gain);
+        voice->position += n;
+        if (voice->position >= voice->length) voice->data = NULL;
+    }
+
+    mix_clip(out, count);
+}
+
+/**
+ * @brief Callback SDL : fournit au périphérique la somme des voix actives, par blocs.
+ * @details Appelé avec le verrou du stream tenu, la latence d'un son est donc bornée par le buffer du périphérique.
+ */
+static void SDLCALL mix_callback(void* userdata, SDL_AudioStream* s, int additional_amount, int total_amount) {
+    (void)userdata; (void)total_amount;
+    int needed = additional_amount / (int)sizeof(float);
+
+    while (needed > 0) {
+        int count = needed < MIX_CHUNK_FRAMES * MIX_CHANNELS ? needed : MIX_CHUNK_FRAMES * MIX_CHANNELS;
+        audio_mix(mix_buffer, count);
+        SDL_PutAudioStreamData(s, mix_buffer, count * (int)sizeof(float));
+        needed -= count;
+    }
+
+    int playing = 0;
+    for (int v = 0; v < MAX_VOICES; v++) playing += (voices[v].data != NULL);
+    atomic_store_explicit(&active_voices, playing, memory_order_relaxed);
+}
+
+/**
+ * @brief Charge un son du bundle : depuis le cache mappé si possible, sinon WAV converti au format de mixage puis mis en cache.
+ */
+void load_sound(int index, const char* name) {
+    size_t file_size = 0;
+    const void* file_data = bundle_get(name, &file_size);
+    if (!file_data) {
+        printf(" Warning: Son introuvable : %s\n", name);
+        return;
+    }
+
+    wav_buffers[index] = audio_cache_load(name, file_data, file_size, &mix_spec, &wav_lengths[index], &wav_mappings[index]);
+    if (wav_buffers[index]) return;
+
     SDL_AudioSpec wav_spec;
     Uint8 *wav_data = NULL;
     Uint32 wav_len = 0;
 
-    if (!SDL_LoadWAV(path, &wav_spec, &wav_data, &wav_len)) {
-        printf(" Warning: Impossible de charger %s : %s\n", path, SDL_GetError());
+    if (!SDL_LoadWAV_IO(SDL_IOFromConstMem(file_data, file_size), true, &wav_spec, &wav_data, &wav_len)) {
+        printf(" Warning: Impossible de charger %s : %s\n", name, SDL_GetError());
         return;
     }
 
-    SDL_AudioSpec device_spec;
-    if (SDL_GetAudioStreamFormat(stream, &device_spec, NULL)) {
-        SDL_ConvertAudioSamples(&wav_spec, wav_data, wav_len, 
-                                &device_spec, &wav_buffers[index], (int*)&wav_lengths[index]);
+    Uint8* converted = NULL;
+    int converted_len = 0;
+    if (SDL_ConvertAudioSamples(&wav_spec, wav_data, wav_len, &mix_spec, &converted, &converted_len)) {
+        wav_buffers[index] = (const float*)converted;
+        wav_lengths[index] = converted_len / (int)sizeof(float);
+        audio_cache_store(name, file_data, file_size, &mix_spec, wav_buffers[index], wav_lengths[index]);
     }
     SDL_free(wav_data);
 }
@@ -45,59 +203,94 @@ int audio_init() {
     if (!SDL_WasInit(SDL_INIT_AUDIO)) {
         if (!SDL_Init(SDL_INIT_AUDIO)) return 0;
     }
+    timings_mark("SDL_Init (audio)");
 
-    stream = SDL_OpenAudioDeviceStream(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, NULL, NULL, NULL);
+    memset(voices, 0, sizeof(voices));
+    stream = SDL_OpenAudioDeviceStream(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, &mix_spec, mix_callback, NULL);
     if (!stream) return 0;
-    
-    SDL_ResumeAudioDevice(SDL_GetAudioStreamDevice(stream));
-    
-    load_sound(0, "assets/shoot.wav");
-    load_sound(1, "assets/enemy_die.wav");
-    load_sound(2, "assets/game_over.wav");
+
+    SDL_ResumeAudioStreamDevice(stream);
+    timings_mark("peripherique audio");
+
+    load_sound(0, "shoot.wav");
+    load_sound(1, "enemy_die.wav");
+    load_sound(2, "game_over.wav");
+    load_sound(3, "invaderkilled.wav");
+    timings_mark("decodage assets audio");
 
     is_audio_initialized = 1;
     return 1;
 }
 
-void audio_play(SoundType type) {
+void audio_play_gain(SoundType type, float gain) {
     if (!stream || !is_audio_initialized) return;
-    
-    // ANTI-LAG : Si trop de son en attente, on drop
-    if (SDL_GetAudioStreamQueued(stream) > MAX_AUDIO_LAG) {
-        return; 
-    }
 
     int index = (int)type;
-    if (index < 0 || index > 2) return;
+    if (index < 0 || index >= SOUND_COUNT) return;
 
-    if (wav_buffers[index] && wav_lengths[index] > 0) {
-        SDL_PutAudioStreamData(stream, wav_buffers[index], wav_lengths[index]);
-    }
+    // Producteur unique : jamais de verrou, la demande est ignorée si la file est pleine
+    unsigned head = atomic_load_explicit(&command_head, memory_order_relaxed);
+    unsigned tail = atomic_load_explicit(&command_tail, memory_order_acquire);
+    if (head - tail >= COMMAND_QUEUE_SIZE) return;
+    commands[head & (COMMAND_QUEUE_SIZE - 1)].sound = index;
+    commands[head & (COMMAND_QUEUE_SIZE - 1)].gain = gain;
+    atomic_store_explicit(&command_head, head + 1, memory_order_release);
+}
+
+void audio_play(SoundType type) {
+    audio_play_gain(type, 1.0f);
 }
 
 void audio_set_volume(int volume) {
     if (!stream) return;
     if (volume < 0) volume = 0;
     if (volume > 100) volume = 100;
-    
+
     float gain = (float)volume / 100.0f;
     SDL_SetAudioStreamGain(stream, gain);
 }
 
+void audio_pause() {
+    if (!stream) return;
+    // Le callback tient ce verrou : on peut toucher aux voix et à la file sans course
+    SDL_LockAudioStream(stream);
+    for (int v = 0; v < MAX_VOICES; v++) voices[v].data = NULL;
+    atomic_store(&command_tail, atomic_load(&command_head));
+    SDL_UnlockAudioStream(stream);
+    SDL_ClearAudioStream(stream);
+    SDL_PauseAudioStreamDevice(stream);
+}
+
+void audio_resume() {
+    if (!stream) return;
+    SDL_ResumeAudioStreamDevice(stream);
+}
+
+int audio_get_queued_bytes() {
+    return stream ? SDL_GetAudioStreamQueued(stream) : 0;
+}
+
+int audio_get_active_voices() {
+    return atomic_load_explicit(&active_voices, memory_order_relaxed);
+}
+
 void audio_update() { }
 
 void audio_shutdown() {
     if (!is_audio_initialized) return;
-    for(int i=0; i<3; i++) {
-        if (wav_buffers[i]) {
-            SDL_free(wav_buffers[i]);
-            wav_buffers[i] = NULL;
-            wav_lengths[i] = 0;
-        }
-    }
+    // Détruire le stream d'abord : le callback ne lit plus les buffers ensuite
     if (stream) {
         SDL_DestroyAudioStream(stream);
         stream = NULL;
     }
+    for(int i=0; i<SOUND_COUNT; i++) {
+        if (wav_mappings[i].base) {
+            audio_cache_release(&wav_mappings[i]);
+        } else if (wav_buffers[i]) {
+            SDL_free((void*)wav_buffers[i]);
+        }
+        wav_buffers[i] = NULL;
+        wav_lengths[i] = 0;
+    }
     is_audio_initialized = 0;
-}
\ No newline at end of file
+}
@@ -2,6 +2,7 @@
  * @file audio.h
  * @brief Gestion du son.
  * @details Interface pour l'initialisation, la lecture et le nettoyage du système audio.
+ *          Les sons se superposent : chaque lecture occupe une voix du mixeur.
  */
 
 #ifndef AUDIO_H
@@ -10,13 +11,26 @@
 typedef enum {
     SOUND_SHOOT,
     SOUND_ENEMY_DIE,
-    SOUND_GAME_OVER
+    SOUND_GAME_OVER,
+    SOUND_UFO_DIE
 } SoundType;
 
 int audio_init();
 void audio_shutdown();
+// Non bloquant : la demande passe par une file lock-free lue par le thread audio
 void audio_play(SoundType type); 
+void audio_play_gain(SoundType type, float gain); // Gain propre à la voix (0.0 - 1.0)
 void audio_update(); 
 void audio_set_volume(int volume); // 0-100
+void audio_pause();  // Met le périphérique en pause (sons conservés en mémoire)
+void audio_resume();
+
+// Mixe count floats (stéréo entrelacé) : appelé par le callback audio, ou directement par le benchmark
+// quand le périphérique est en pause (un seul consommateur à la fois)
+void audio_mix(float* out, int count);
+
+// Indicateurs pour l'overlay de performance
+int audio_get_queued_bytes(); // Données en attente dans le stream SDL
+int audio_get_active_voices();
 
 #endif
\ No newline at end of file
@@ -0,0 +1,126 @@
+/**
+ * @file audio_cache.c
+ * @brief Implémentation du cache PCM (fichiers binaires dans cache/, lecture par mmap).
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include "audio_cache.h"
+
+#ifndef _WIN32
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <sys/mman.h>
+#endif
+
+#define CACHE_DIR "cache"
+#define CACHE_MAGIC 0x43505349u // "ISPC"
+#define CACHE_VERSION 1
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t source_hash;
+    int32_t format;
+    int32_t channels;
+    int32_t freq;
+    int32_t length;       // Nombre de floats qui suivent l'en-tête
+} CacheHeader;
+
+#ifndef _WIN32
+
+/**
+ * @brief Hash FNV-1a 64 bits du WAV source.
+ */
+static uint64_t hash_data(const void* data, size_t size) {
+    const unsigned char* p = (const unsigned char*)data;
+    uint64_t h = 1469598103934665603ull;
+    for (size_t i = 0; i < size; i++) {
+        h ^= p[i];
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+
+/**
+ * @brief Construit le chemin du cache : cache/<nom>_<hash>_<format>.pcm
+ */
+static void cache_path(char* buf, size_t size, const char* name, uint64_t hash, const SDL_AudioSpec* spec) {
+    snprintf(buf, size, CACHE_DIR "/%s_%016llx_%x_%d_%d.pcm", name, (unsigned long long)hash,
+             (unsigned)spec->format, spec->channels, spec->freq);
+}
+
+const float* audio_cache_load(const char* name, const void* wav_data, size_t wav_size, const SDL_AudioSpec* spec, int* out_length, AudioCacheMapping* mapping) {
+    uint64_t hash = hash_data(wav_data, wav_size);
+
+    char path[256];
+    cache_path(path, sizeof(path), name, hash, spec);
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return NULL;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(CacheHeader)) { close(fd); return NULL; }
+    void* base = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) return NULL;
+
+    const CacheHeader* h = (const CacheHeader*)base;
+    if (h->magic != CACHE_MAGIC || h->version != CACHE_VERSION || h->source_hash != hash ||
+        h->format != (int32_t)spec->format || h->channels != spec->channels || h->freq != spec->freq ||
+        sizeof(CacheHeader) + (size_t)h->length * sizeof(float) != (size_t)st.st_size) {
+        munmap(base, st.st_size);
+        return NULL;
+    }
+
+    mapping->base = base;
+    mapping->size = st.st_size;
+    *out_length = h->length;
+    return (const float*)((const char*)base + sizeof(CacheHeader));
+}
+
+int audio_cache_store(const char* name, const void* wav_data, size_t wav_size, const SDL_AudioSpec* spec, const float* samples, int length) {
+    uint64_t hash = hash_data(wav_data, wav_size);
+    mkdir(CACHE_DIR, 0777);
+
+    char path[256], tmp[272];
+    cache_path(path, sizeof(path), name, hash, spec);
+    snprintf(tmp, sizeof(tmp), "%s.tmp", path);
+
+    CacheHeader h = { CACHE_MAGIC, CACHE_VERSION, hash, (int32_t)spec->format, spec->channels, spec->freq, length };
+    FILE* f = fopen(tmp, "wb");
+    if (!f) return 0;
+    int ok = fwrite(&h, sizeof(h), 1, f) == 1 && fwrite(samples, sizeof(float), length, f) == (size_t)length;
+    fclose(f);
+    // Renommage atomique : un lecteur ne voit jamais de fichier partiel
+    if (!ok || rename(tmp, path) != 0) { remove(tmp); return 0; }
+    return 1;
+}
+
+void audio_cache_release(AudioCacheMapping* mapping) {
+    if (mapping->base) munmap(mapping->base, mapping->size);
+    mapping->base = NULL;
+    mapping->size = 0;
+}
+
+#else
+
+// Pas de mmap sous Windows : le cache est désactivé, les sons sont convertis à chaque lancement
+const float* audio_cache_load(const char* name, const void* wav_data, size_t wav_size, const SDL_AudioSpec* spec, int* out_length, AudioCacheMapping* mapping) {
+    (void)name; (void)wav_data; (void)wav_size; (void)spec; (void)out_length; (void)mapping;
+    return NULL;
+}
+
+int audio_cache_store(const char* name, const void* wav_data, size_t wav_size, const SDL_AudioSpec* spec, const float* samples, int length) {
+    (void)name; (void)wav_data; (void)wav_size; (void)spec; (void)samples; (void)length;
+    return 0;
+}
+
+void audio_cache_release(AudioCacheMapping* mapping) {
+    mapping->base = NULL;
+    mapping->size = 0;
+}
+
+#endif
@@ -0,0 +1,27 @@
+/**
+ * @file audio_cache.h
+ * @brief Cache disque des sons déjà convertis au format de mixage.
+ * @details Les fichiers sont indexés par le hash du WAV source et le format cible,
+ *          puis mappés en mémoire au démarrage (aucun décodage ni conversion si le cache est valide).
+ */
+
+#ifndef AUDIO_CACHE_H
+#define AUDIO_CACHE_H
+
+#include <stddef.h>
+#include <SDL3/SDL.h>
+
+/**
+ * @brief Zone mappée d'un son en cache (à libérer avec audio_cache_release).
+ */
+typedef struct {
+    void* base;
+    size_t size;
+} AudioCacheMapping;
+
+// Retourne les échantillons (en floats) ou NULL si absent/périmé. wav_data : contenu du WAV source.
+const float* audio_cache_load(const char* name, const void* wav_data, size_t wav_size, const SDL_AudioSpec* spec, int* out_length, AudioCacheMapping* mapping);
+int audio_cache_store(const char* name, const void* wav_data, size_t wav_size, const SDL_AudioSpec* spec, const float* samples, int length);
+void audio_cache_release(AudioCacheMapping* mapping);
+
+#endif
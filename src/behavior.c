@@ -0,0 +1,165 @@
+/**
+ * @file behavior.c
+ * @brief Table des comportements installée et interpréteur des programmes.
+ */
+
+#include <string.h>
+#include "behavior.h"
+
+_Static_assert(sizeof(BehaviorFileHeader) == 40 && sizeof(BehaviorProgram) == 8,
+               "Les structures de la table des comportements font partie du format de fichier");
+
+// Formation d'origine : pas de la formation, puis tir avec la chance du type
+static const uint32_t builtin_code[] = {
+    BEHAVIOR_OP(OP_ADD, REG_X, REG_X, REG_DX),
+    BEHAVIOR_OP(OP_ROLL, REG_T0, 0, 0),
+    BEHAVIOR_OP(OP_JGE, 1, REG_T0, REG_CHANCE),
+    BEHAVIOR_OP(OP_FIRE, 0, 0, 0),
+    BEHAVIOR_OP(OP_END, 0, 0, 0),
+};
+static const BehaviorProgram builtin_program = { 0, sizeof(builtin_code) / sizeof(uint32_t), 0, 0 };
+static const uint8_t builtin_types[WAVES_MAX_TYPES] = { 0 };
+
+static const BehaviorProgram* programs = &builtin_program;
+static const uint32_t* code = builtin_code;
+static const float* consts = NULL;
+static const uint8_t* type_program = builtin_types;
+static uint32_t program_count = 1;
+static uint64_t table_hash = 0;
+
+/**
+ * @brief Contrôle un programme : opcodes connus, registres écrits valides, opérandes lus existants,
+ *        sauts vers l'avant qui restent dans le programme, END en dernière instruction.
+ */
+static int program_valid(const BehaviorProgram* p, const uint32_t* words) {
+    uint32_t operands = BEHAVIOR_REGS + p->const_count;
+    for (uint32_t pc = 0; pc < p->word_count; pc++) {
+        uint32_t w = words[pc], op = w & 0xFF, a = (w >> 8) & 0xFF, b = (w >> 16) & 0xFF, c = w >> 24;
+        switch (op) {
+            case OP_END: case OP_FIRE: break;
+            case OP_ROLL: if (a >= BEHAVIOR_REGS) return 0; break;
+            case OP_MOV: case OP_ABS: if (a >= BEHAVIOR_REGS || b >= operands) return 0; break;
+            case OP_ADD: case OP_SUB: case OP_MUL: case OP_MIN: case OP_MAX:
+                if (a >= BEHAVIOR_REGS || b >= operands || c >= operands) return 0;
+                break;
+            case OP_JLT: case OP_JGE: if (b >= operands || c >= operands) return 0; // Puis le saut
+            /* fallthrough */
+            case OP_JMP: if ((int8_t)a < 0 || pc + 1 + a >= p->word_count) return 0; break;
+            default: return 0;
+        }
+    }
+    return (words[p->word_count - 1] & 0xFF) == OP_END;
+}
+
+int behavior_set(const void* data, size_t size) {
+    if (!data) {
+        programs = &builtin_program; code = builtin_code; consts = NULL; type_program = builtin_types;
+        program_count = 1; table_hash = 0;
+        return 1;
+    }
+    const BehaviorFileHeader* h = data;
+    if (size < sizeof(*h) || h->magic != BEHAVIOR_MAGIC || h->version != BEHAVIOR_VERSION
+        || h->program_count == 0 || h->program_count > BEHAVIOR_MAX_PROGRAMS) return 0;
+    uint64_t expected = sizeof(*h) + (uint64_t)h->program_count * sizeof(BehaviorProgram)
+                      + (uint64_t)h->code_words * sizeof(uint32_t) + (uint64_t)h->const_count * sizeof(float);
+    uint64_t hash = fnv1a(FNV1A_OFFSET, h->type_program, sizeof(h->type_program));
+    if (expected != size || fnv1a(hash, (const unsigned char*)data + sizeof(*h), size - sizeof(*h)) != h->hash) return 0;
+
+    const BehaviorProgram* p = (const BehaviorProgram*)(h + 1);
+    const uint32_t* w = (const uint32_t*)(p + h->program_count);
+    const float* k = (const float*)(w + h->code_words);
+    for (uint32_t i = 0; i < h->program_count; i++) {
+        if (p[i].word_count == 0 || p[i].word_count > BEHAVIOR_MAX_CODE || p[i].first_word + p[i].word_count > h->code_words
+            || p[i].const_count > BEHAVIOR_MAX_CONSTS || p[i].first_const + p[i].const_count > h->const_count
+            || !program_valid(&p[i], w + p[i].first_word)) return 0;
+    }
+    for (int t = 0; t < WAVES_MAX_TYPES; t++) if (h->type_program[t] >= h->program_count) return 0;
+
+    programs = p; code = w; consts = k; type_program = h->type_program;
+    program_count = h->program_count; table_hash = h->hash;
+    return 1;
+}
+
+uint64_t behavior_hash(void) { return table_hash; }
+
+int behavior_program_count(void) { return (int)program_count; }
+
+int behavior_program_of(int type) { return type_program[(uint32_t)type < WAVES_MAX_TYPES ? (uint32_t)type : 0]; }
+
+static void enemy_fire(GameState* state, float x, float y) {
+    for (int k = 0; k < MAX_ENEMY_SHOTS; k++) {
+        if (!state->enemy_shots[k].active) {
+            state->enemy_shots[k].active = 1;
+            state->enemy_shots[k].pos.x = x + ENEMY_W / 2;
+            state->enemy_shots[k].pos.y = y + ENEMY_H;
+            break;
+        }
+    }
+}
+
+/**
+ * @details Le même programme tourne pour tout le lot : son code et ses constantes (recopiées une fois
+ *          derrière les registres, d'où un seul tableau d'opérandes) restent en cache d'un ennemi à l'autre.
+ */
+void behavior_run(int program, const BehaviorContext* ctx, Enemy* enemies, const int* order, int count) {
+    const BehaviorProgram* p = &programs[program];
+    const uint32_t* words = code + p->first_word;
+    GameState* state = ctx->state;
+    float frame[BEHAVIOR_REGS + BEHAVIOR_MAX_CONSTS]; // Registres puis constantes du programme
+    if (p->const_count) memcpy(frame + BEHAVIOR_REGS, consts + p->first_const, p->const_count * sizeof(float));
+
+    #define A frame[(w >> 8) & 0xFF]
+    #define B frame[(w >> 16) & 0xFF]
+    #define C frame[w >> 24]
+    #define JUMP (pc += (int8_t)(w >> 8))
+    for (int n = 0; n < count; n++) {
+        Enemy* e = &enemies[order[n]];
+        frame[REG_X] = e->pos.x;
+        frame[REG_Y] = e->pos.y;
+        frame[REG_DX] = ctx->dx;
+        frame[REG_PX] = state->pos.x;
+        frame[REG_CHANCE] = (float)ctx->shot_chance[e->type & (WAVES_MAX_TYPES - 1)];
+        frame[REG_LEVEL] = (float)state->level;
+        memcpy(&frame[REG_P0], e->reg, sizeof(e->reg));
+        memset(&frame[REG_T0], 0, (BEHAVIOR_REGS - REG_T0) * sizeof(float));
+
+        const uint32_t* pc = words;
+        for (uint32_t w; ((w = *pc++) & 0xFF) != OP_END;) {
+            switch (w & 0xFF) {
+                case OP_MOV: A = B; break;
+                case OP_ADD: A = B + C; break;
+                case OP_SUB: A = B - C; break;
+                case OP_MUL: A = B * C; break;
+                case OP_MIN: A = B < C ? B : C; break;
+                case OP_MAX: A = B > C ? B : C; break;
+                case OP_ABS: A = B < 0 ? -B : B; break;
+                case OP_JMP: JUMP; break;
+                case OP_JLT: if (B < C) JUMP; break;
+                case OP_JGE: if (B >= C) JUMP; break;
+                case OP_ROLL: A = (float)(model_random(state) % RULES_SHOT_RANGE); break;
+                case OP_FIRE: enemy_fire(state, frame[REG_X], frame[REG_Y]); break;
+                default: break;
+            }
+        }
+
+        e->pos.x = frame[REG_X];
+        e->pos.y = frame[REG_Y];
+        memcpy(e->reg, &frame[REG_P0], sizeof(e->reg));
+    }
+    #undef A
+    #undef B
+    #undef C
+    #undef JUMP
+}
+
+/**
+ * @details Tri par comptage des ennemis vivants selon leur programme : dans un groupe, l'ordre des indices
+ *          est conservé (les tirages du générateur suivent donc toujours le même ordre).
+ */
+void behavior_run_all(const BehaviorContext* ctx, Enemy* enemies, int count, int* order) {
+    int first[BEHAVIOR_MAX_PROGRAMS + 1] = {0}, next[BEHAVIOR_MAX_PROGRAMS];
+    for (int i = 0; i < count; i++) if (enemies[i].alive) first[behavior_program_of(enemies[i].type) + 1]++;
+    for (int p = 0; p < BEHAVIOR_MAX_PROGRAMS; p++) { first[p + 1] += first[p]; next[p] = first[p]; }
+    for (int i = 0; i < count; i++) if (enemies[i].alive) order[next[behavior_program_of(enemies[i].type)]++] = i;
+    for (int p = 0; p < (int)program_count; p++) behavior_run(p, ctx, enemies, order + first[p], first[p + 1] - first[p]);
+}
@@ -0,0 +1,104 @@
+/**
+ * @file behavior.h
+ * @brief Comportements des ennemis : petite machine virtuelle à registres, un programme par type d'ennemi.
+ * @details Les programmes sont écrits en assembleur (assets/behaviors.s), assemblés par tools/behavior_asm
+ *          en table binaire placée dans le bundle : BehaviorFileHeader, BehaviorProgram[program_count],
+ *          code (uint32_t[code_words]), constantes (float[const_count]). Sans table, tous les types suivent
+ *          le programme intégré de la formation d'origine (mêmes tirages, simulation identique).
+ *
+ *          Chaque tick, model_update appelle behavior_run_all : les ennemis vivants sont regroupés par
+ *          programme, puis chaque programme s'exécute une fois par ennemi de son groupe. Une instruction est un mot de 32 bits :
+ *          op | a << 8 | b << 16 | c << 24. Les opérandes lus (b, c) désignent un registre (0 à 15) ou,
+ *          au-delà, une constante du programme (16 + indice) ; a désigne le registre écrit, ou le saut
+ *          (signé, relatif à l'instruction suivante) des branchements. Les sauts vont uniquement vers
+ *          l'avant : un programme s'exécute toujours en au plus BEHAVIOR_MAX_CODE instructions.
+ *
+ *          Registres à l'entrée : x, y (position), dx (pas de la formation ce tick), px (position du
+ *          joueur), chance (seuil de tir du type et du niveau, sur RULES_SHOT_RANGE), level, p0 à p3
+ *          (mémoire de l'ennemi, conservée d'un tick à l'autre dans Enemy.reg), t0 à t5 (nuls).
+ *          À la sortie, x, y et p0 à p3 sont réécrits dans l'ennemi.
+ */
+
+#ifndef BEHAVIOR_H
+#define BEHAVIOR_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "waves.h"
+
+#define BEHAVIOR_FILE "behaviors.bin"   // Nom de l'entrée dans le bundle
+#define BEHAVIOR_MAGIC 0x31564249u      // "IBV1"
+#define BEHAVIOR_VERSION 1
+#define BEHAVIOR_MAX_PROGRAMS 8
+#define BEHAVIOR_MAX_CODE 256           // Instructions par programme
+#define BEHAVIOR_REGS 16
+#define BEHAVIOR_MAX_CONSTS (256 - BEHAVIOR_REGS)
+
+typedef enum {
+    OP_END,     // Fin du programme
+    OP_MOV,     // a = b
+    OP_ADD,     // a = b + c
+    OP_SUB,     // a = b - c
+    OP_MUL,     // a = b * c
+    OP_MIN,     // a = min(b, c)
+    OP_MAX,     // a = max(b, c)
+    OP_ABS,     // a = |b|
+    OP_JMP,     // saut de a
+    OP_JLT,     // saut de a si b < c
+    OP_JGE,     // saut de a si b >= c
+    OP_ROLL,    // a = tirage du générateur de la partie, de 0 à RULES_SHOT_RANGE - 1
+    OP_FIRE,    // tir ennemi depuis la position courante (si un emplacement est libre)
+    OP_COUNT
+} BehaviorOp;
+
+typedef enum {
+    REG_X, REG_Y, REG_DX, REG_PX, REG_CHANCE, REG_LEVEL,
+    REG_P0, REG_P1, REG_P2, REG_P3,
+    REG_T0, REG_T1, REG_T2, REG_T3, REG_T4, REG_T5
+} BehaviorReg;
+
+#define BEHAVIOR_OP(op, a, b, c) ((uint32_t)(op) | (uint32_t)(uint8_t)(a) << 8 | (uint32_t)(b) << 16 | (uint32_t)(c) << 24)
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t program_count;
+    uint32_t code_words;
+    uint32_t const_count;
+    uint32_t reserved;
+    uint8_t type_program[WAVES_MAX_TYPES]; // Programme de chaque type d'ennemi
+    uint64_t hash;                  // FNV-1a de type_program et du reste du fichier (enregistré dans les replays)
+} BehaviorFileHeader;
+
+typedef struct {
+    uint16_t first_word;            // Indice dans le code
+    uint16_t word_count;
+    uint16_t first_const;           // Indice dans les constantes
+    uint16_t const_count;
+} BehaviorProgram;
+
+/**
+ * @brief Contexte commun d'un tick : entrées des registres et destination des tirs.
+ */
+typedef struct {
+    GameState* state;               // Générateur (ROLL) et tirs ennemis (FIRE)
+    float dx;
+    const uint32_t* shot_chance;    // Seuil de tir par type d'ennemi
+} BehaviorContext;
+
+/**
+ * @brief Vérifie et installe une table (non copiée : data doit rester valide) ; NULL rétablit le programme intégré.
+ * @return 1 si la table est installée, 0 si elle est invalide (la précédente est conservée).
+ */
+int behavior_set(const void* data, size_t size);
+uint64_t behavior_hash(void);       // Empreinte de la table installée (0 : programme intégré)
+int behavior_program_count(void);
+int behavior_program_of(int type);
+
+// Exécute le programme `program` pour les ennemis enemies[order[0..count-1]], dans cet ordre
+void behavior_run(int program, const BehaviorContext* ctx, Enemy* enemies, const int* order, int count);
+
+// Un tick des ennemis vivants de enemies[0..count-1], groupe par groupe (order : tableau de travail de count entiers)
+void behavior_run_all(const BehaviorContext* ctx, Enemy* enemies, int count, int* order);
+
+#endif
@@ -0,0 +1,305 @@
+/**
+ * @file bot.c
+ * @brief Implémentation du bot MCTS (UCT en boucle ouverte, threads SDL persistants).
+ * @details Arbre en boucle ouverte : les nœuds ne stockent pas d'état, chaque itération rejoue le chemin
+ * depuis la racine avec une nouvelle graine pour les tirs ennemis et l'UFO. Le bot ne peut donc pas
+ * exploiter le générateur de la partie et l'arbre mesure l'espérance de chaque suite de coups.
+ */
+
+#include <SDL3/SDL.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "bot.h"
+#include "profiler.h"
+#include "replay.h"
+#include "highscore.h"
+
+#ifdef _WIN32
+    #include <direct.h>
+#else
+    #include <sys/stat.h>
+#endif
+
+#define BOT_ACTIONS 4          // NONE, LEFT, RIGHT, SHOOT
+#define BOT_REPEAT 4           // Ticks par coup dans l'arbre et les rollouts
+#define BOT_MAX_DEPTH 8        // Profondeur maximale de l'arbre, en coups
+#define BOT_ROLLOUT_MOVES 12   // Coups aléatoires après la feuille (48 ticks)
+#define BOT_MAX_NODES 16384    // Nœuds par thread et par décision
+#define BOT_UCB_C 1.0f
+#define BOT_LIFE_PENALTY 300.0f
+#define BOT_GAME_OVER_PENALTY 1000.0f
+#define BOT_REWARD_SCALE 100.0f
+#define BOT_MAX_THREADS 64
+#define TOURNAMENT_MAX_TICKS 18000 // 5 minutes de jeu à 60 ticks/s
+
+static const InputType bot_actions[BOT_ACTIONS] = { INPUT_NONE, INPUT_LEFT, INPUT_RIGHT, INPUT_SHOOT };
+
+typedef struct {
+    int child[BOT_ACTIONS]; // 0 : pas encore développé (la racine est le nœud 0)
+    int visits;
+    float value;            // Somme des récompenses normalisées
+} BotNode;
+
+typedef struct {
+    Bot* bot;
+    SDL_Thread* thread;
+    SDL_Semaphore* start;
+    BotNode* nodes;
+    int node_count;
+    uint64_t rng;
+    uint64_t rollouts, ticks;
+} BotWorker;
+
+struct Bot {
+    int thread_count;
+    float budget_ms;
+    BotWorker workers[BOT_MAX_THREADS];
+    SDL_Semaphore* done;
+    ModelSnapshot root;      // État à explorer, en lecture seule pendant la recherche
+    GameRules rules;         // Règles de la partie (hors instantané), recopiées dans chaque simulation
+    Uint64 deadline;
+    int quit;
+    BotStats stats;
+};
+
+static uint32_t worker_random(BotWorker* w) {
+    uint64_t x = w->rng;
+    x ^= x >> 12; x ^= x << 25; x ^= x >> 27;
+    w->rng = x;
+    return (uint32_t)((x * 0x2545F4914F6CDD1Dull) >> 32);
+}
+
+/**
+ * @brief Joue un coup pendant BOT_REPEAT ticks et renvoie la récompense (score, vies perdues, fin de partie).
+ */
+static float play_move(GameState* sim, int action, BotWorker* w) {
+    int score = sim->score, lives = sim->lives;
+    for (int t = 0; t < BOT_REPEAT && !sim->game_over; t++) {
+        switch (bot_actions[action]) {
+            case INPUT_LEFT: model_move_left(sim); break;
+            case INPUT_RIGHT: model_move_right(sim); break;
+            case INPUT_SHOOT: model_shoot(sim); break;
+            default: break;
+        }
+        model_tick(sim);
+        model_clear_events(sim);
+        w->ticks++;
+    }
+    float reward = (float)(sim->score - score) - BOT_LIFE_PENALTY * (lives - sim->lives);
+    if (sim->game_over) reward -= BOT_GAME_OVER_PENALTY;
+    return reward / BOT_REWARD_SCALE;
+}
+
+static int select_child(const BotNode* nodes, const BotNode* node) {
+    int best = 0;
+    float best_score = -INFINITY;
+    float log_n = logf((float)node->visits + 1.0f);
+    for (int a = 0; a < BOT_ACTIONS; a++) {
+        const BotNode* c = &nodes[node->child[a]];
+        float score = c->value / c->visits + BOT_UCB_C * sqrtf(log_n / c->visits);
+        if (score > best_score) { best_score = score; best = a; }
+    }
+    return best;
+}
+
+/**
+ * @brief Une itération MCTS : sélection, expansion d'un nœud, rollout aléatoire, rétropropagation.
+ */
+static void mcts_iteration(BotWorker* w) {
+    GameState sim;
+    sim.rules = w->bot->rules;
+    model_restore(&sim, &w->bot->root);
+    model_seed(&sim, ((uint64_t)worker_random(w) << 32) | worker_random(w)); // Futur aléatoire propre à l'itération
+
+    int path[BOT_MAX_DEPTH + 1];
+    int depth = 0;
+    float reward = 0;
+    int node = 0;
+    path[depth++] = node;
+
+    while (depth <= BOT_MAX_DEPTH && !sim.game_over) {
+        BotNode* n = &w->nodes[node];
+        int untried = -1;
+        for (int a = 0; a < BOT_ACTIONS; a++) if (!n->child[a]) { untried = a; break; }
+        if (untried >= 0) {
+            if (w->node_count >= BOT_MAX_NODES) break; // Arbre plein : rollout depuis ce nœud
+            int c = w->node_count++;
+            w->nodes[c] = (BotNode){ {0}, 0, 0 };
+            n->child[untried] = c;
+            reward += play_move(&sim, untried, w);
+            path[depth++] = c;
+            break;
+        }
+        int a = select_child(w->nodes, n);
+        reward += play_move(&sim, a, w);
+        node = n->child[a];
+        path[depth++] = node;
+    }
+
+    for (int m = 0; m < BOT_ROLLOUT_MOVES && !sim.game_over; m++) reward += play_move(&sim, worker_random(w) % BOT_ACTIONS, w);
+
+    for (int i = 0; i < depth; i++) {
+        w->nodes[path[i]].visits++;
+        w->nodes[path[i]].value += reward;
+    }
+    w->rollouts++;
+}
+
+static void search(BotWorker* w) {
+    PROFILE_BEGIN(prof_search, "mcts");
+    w->nodes[0] = (BotNode){ {0}, 0, 0 };
+    w->node_count = 1;
+    do {
+        mcts_iteration(w);
+    } while (SDL_GetPerformanceCounter() < w->bot->deadline);
+    PROFILE_END(prof_search);
+}
+
+static int SDLCALL worker_main(void* data) {
+    BotWorker* w = (BotWorker*)data;
+    while (1) {
+        SDL_WaitSemaphore(w->start);
+        if (w->bot->quit) break;
+        search(w);
+        SDL_SignalSemaphore(w->bot->done);
+    }
+    return 0;
+}
+
+Bot* bot_create(int threads, float budget_ms) {
+    if (threads < 1) threads = 1;
+    if (threads > BOT_MAX_THREADS) threads = BOT_MAX_THREADS;
+    Bot* bot = calloc(1, sizeof(Bot));
+    if (!bot) return NULL;
+    bot->thread_count = threads;
+    bot->budget_ms = budget_ms > 0 ? budget_ms : 1.0f;
+    bot->done = SDL_CreateSemaphore(0);
+
+    for (int i = 0; i < threads; i++) {
+        BotWorker* w = &bot->workers[i];
+        w->bot = bot;
+        w->rng = 0x9E3779B97F4A7C15ull * (i + 1);
+        w->nodes = malloc(BOT_MAX_NODES * sizeof(BotNode));
+        if (!w->nodes) { bot_destroy(bot); return NULL; }
+        if (i == 0) continue; // Le thread 0 est l'appelant de bot_choose
+        w->start = SDL_CreateSemaphore(0);
+        w->thread = SDL_CreateThread(worker_main, "mcts", w);
+        if (!w->thread) { printf(" Warning: thread MCTS impossible : %s\n", SDL_GetError()); bot->thread_count = i; break; }
+    }
+    return bot;
+}
+
+void bot_destroy(Bot* bot) {
+    if (!bot) return;
+    bot->quit = 1;
+    for (int i = 1; i < BOT_MAX_THREADS; i++) {
+        BotWorker* w = &bot->workers[i];
+        if (w->thread) { SDL_SignalSemaphore(w->start); SDL_WaitThread(w->thread, NULL); }
+        if (w->start) SDL_DestroySemaphore(w->start);
+    }
+    for (int i = 0; i < BOT_MAX_THREADS; i++) free(bot->workers[i].nodes);
+    if (bot->done) SDL_DestroySemaphore(bot->done);
+    free(bot);
+}
+
+InputType bot_choose(Bot* bot, const GameState* state) {
+    if (state->game_over) return INPUT_NONE;
+    Uint64 start = SDL_GetPerformanceCounter();
+    model_snapshot(state, &bot->root);
+    bot->rules = state->rules;
+    bot->deadline = start + (Uint64)(bot->budget_ms * SDL_GetPerformanceFrequency() / 1000.0);
+
+    for (int i = 1; i < bot->thread_count; i++) SDL_SignalSemaphore(bot->workers[i].start);
+    search(&bot->workers[0]);
+    for (int i = 1; i < bot->thread_count; i++) SDL_WaitSemaphore(bot->done);
+
+    // Coup le plus visité sur l'ensemble des arbres
+    int visits[BOT_ACTIONS] = {0};
+    for (int i = 0; i < bot->thread_count; i++) {
+        BotWorker* w = &bot->workers[i];
+        for (int a = 0; a < BOT_ACTIONS; a++) if (w->nodes[0].child[a]) visits[a] += w->nodes[w->nodes[0].child[a]].visits;
+    }
+    int best = 0;
+    for (int a = 1; a < BOT_ACTIONS; a++) if (visits[a] > visits[best]) best = a;
+
+    bot->stats.decisions++;
+    bot->stats.search_ms += (SDL_GetPerformanceCounter() - start) * 1000.0 / SDL_GetPerformanceFrequency();
+    return bot_actions[best];
+}
+
+void bot_get_stats(const Bot* bot, BotStats* stats) {
+    *stats = bot->stats;
+    stats->rollouts = stats->ticks = 0;
+    for (int i = 0; i < bot->thread_count; i++) {
+        stats->rollouts += bot->workers[i].rollouts;
+        stats->ticks += bot->workers[i].ticks;
+    }
+}
+
+int bot_tournament(int games, int threads, float budget_ms, uint64_t seed, const char* record_dir) {
+    Bot* bot = bot_create(threads, budget_ms);
+    if (!bot) return 0;
+    printf("--- Tournoi MCTS : %d parties, %d threads, %.1f ms par coup ---\n", games, bot->thread_count, bot->budget_ms);
+
+    model_init_save_system();
+    HighScoreTable* high_scores = highscore_open(HIGHSCORE_PATH); // Partagé sans risque entre tournois parallèles
+    long best_rank = 0;
+
+    if (record_dir) {
+    #ifdef _WIN32
+        _mkdir(record_dir);
+    #else
+        mkdir(record_dir, 0777);
+    #endif
+    }
+
+    long total_score = 0;
+    uint64_t replay_bytes = 0;
+    int best_score = 0, worst_score = -1;
+    for (int g = 0; g < games; g++) {
+        GameState state = {0};
+        model_new_game(&state, NULL);
+        replay_start_state(&state, seed + g, state.settings.player_speed);
+        ReplayWriter* writer = record_dir ? replay_writer_create(seed + g, state.settings.player_speed, 0) : NULL;
+        int ticks = 0;
+        while (!state.game_over && ticks < TOURNAMENT_MAX_TICKS) {
+            InputType input = bot_choose(bot, &state);
+            if (writer) replay_writer_record(writer, &state, input);
+            replay_apply_input(&state, input);
+            model_tick(&state);
+            model_clear_events(&state);
+            ticks++;
+        }
+        if (writer) {
+            char path[512];
+            snprintf(path, sizeof(path), "%s/game_%04d.replay", record_dir, g + 1);
+            if (!replay_writer_save(writer, &state, path)) printf("Impossible d'écrire le replay %s\n", path);
+            else replay_bytes += replay_writer_size(writer);
+            replay_writer_destroy(writer);
+        }
+        printf("  Partie %2d : score %6d, niveau %2d, %d vies, %d ticks%s\n", g + 1, state.score, state.level,
+               state.lives, ticks, state.game_over ? "" : " (limite atteinte)");
+        if (high_scores) {
+            HighScore entry;
+            highscore_entry(&entry, state.score, state.level, "bot-mcts");
+            long rank = highscore_insert(high_scores, &entry);
+            if (rank > 0 && (best_rank == 0 || rank < best_rank)) best_rank = rank;
+        }
+        total_score += state.score;
+        if (state.score > best_score) best_score = state.score;
+        if (worst_score < 0 || state.score < worst_score) worst_score = state.score;
+    }
+
+    BotStats stats;
+    bot_get_stats(bot, &stats);
+    double seconds = stats.search_ms / 1000.0;
+    printf("Score moyen %.1f (min %d, max %d)\n", games > 0 ? (double)total_score / games : 0.0, worst_score < 0 ? 0 : worst_score, best_score);
+    printf("Recherche : %llu coups, %.0f rollouts/s, %.2f M ticks simulés/s\n", (unsigned long long)stats.decisions,
+           seconds > 0 ? stats.rollouts / seconds : 0.0, seconds > 0 ? stats.ticks / seconds / 1e6 : 0.0);
+    if (high_scores) printf("Meilleur rang au tableau des scores : %ld sur %ld\n", best_rank, highscore_count(high_scores));
+    highscore_close(high_scores);
+    if (record_dir && games > 0) printf("Replays dans %s : %.0f octets par partie en moyenne\n", record_dir, (double)replay_bytes / games);
+    bot_destroy(bot);
+    return 1;
+}
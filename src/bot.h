@@ -0,0 +1,43 @@
+/**
+ * @file bot.h
+ * @brief Joueur automatique par recherche arborescente Monte-Carlo (option --bot mcts).
+ * @details Parallélisation à la racine : chaque thread construit son propre arbre depuis l'état courant
+ *          pendant le budget de temps du tick, puis les visites des coups racine sont additionnées.
+ *          Les simulations utilisent model_tick sur des copies (ModelSnapshot) : l'état du jeu n'est jamais modifié.
+ */
+
+#ifndef BOT_H
+#define BOT_H
+
+#include <stdint.h>
+#include "model.h"
+
+typedef struct Bot Bot;
+
+typedef struct {
+    uint64_t decisions;   // Nombre de coups choisis
+    uint64_t rollouts;    // Simulations complètes, tous threads confondus
+    uint64_t ticks;       // Ticks de model_tick simulés par la recherche
+    double search_ms;     // Temps total passé à chercher
+} BotStats;
+
+/**
+ * @brief Crée un bot MCTS et ses threads de recherche (threads - 1 threads + l'appelant).
+ * @param budget_ms Temps de recherche par coup, en millisecondes.
+ */
+Bot* bot_create(int threads, float budget_ms);
+void bot_destroy(Bot* bot);
+
+// Coup à jouer pour ce tick : INPUT_NONE, INPUT_LEFT, INPUT_RIGHT ou INPUT_SHOOT
+InputType bot_choose(Bot* bot, const GameState* state);
+
+void bot_get_stats(const Bot* bot, BotStats* stats);
+
+/**
+ * @brief Tournoi headless : `games` parties jouées par le bot, graines seed, seed+1...
+ * @param record_dir Dossier des replays (game_0001.replay...), sans images clés ; NULL : pas d'enregistrement.
+ * @return 1 si succès, 0 si le bot n'a pas pu être créé.
+ */
+int bot_tournament(int games, int threads, float budget_ms, uint64_t seed, const char* record_dir);
+
+#endif
@@ -0,0 +1,158 @@
+/**
+ * @file bundle.c
+ * @brief Lecture du bundle d'assets (embarqué, ou mappé depuis le dossier de l'exécutable).
+ * @details Ordre de recherche : bundle embarqué (EMBED_ASSETS), <dossier exe>/assets.bundle,
+ *          ./assets.bundle, puis fichiers isolés assets/<nom> en dernier recours.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include <SDL3/SDL.h>
+#include <stdio.h>
+#include <string.h>
+#include "bundle.h"
+
+#ifndef _WIN32
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <sys/stat.h>
+    #include <sys/mman.h>
+#endif
+
+#ifdef EMBED_ASSETS
+// Le bundle est inclus tel quel dans .rodata au moment de l'assemblage
+__asm__(".section .rodata\n"
+        ".balign 64\n"
+        ".global embedded_bundle\n"
+        "embedded_bundle:\n"
+        ".incbin \"" EMBED_BUNDLE_PATH "\"\n"
+        ".global embedded_bundle_end\n"
+        "embedded_bundle_end:\n"
+        ".previous\n");
+extern const unsigned char embedded_bundle[];
+extern const unsigned char embedded_bundle_end[];
+#endif
+
+#define MAX_LOOSE_FILES 8
+
+typedef struct { char name[BUNDLE_NAME_MAX]; void* data; size_t size; } LooseFile;
+
+static const unsigned char* bundle_data = NULL;
+static size_t bundle_size = 0;
+static int bundle_mapped = 0;
+static int bundle_tried = 0;
+static LooseFile loose_files[MAX_LOOSE_FILES];
+static int loose_count = 0;
+
+/**
+ * @brief Vérifie l'en-tête et la table d'entrées (bornes comprises).
+ */
+static int bundle_validate(const unsigned char* data, size_t size) {
+    if (size < sizeof(BundleHeader)) return 0;
+    const BundleHeader* h = (const BundleHeader*)data;
+    if (h->magic != BUNDLE_MAGIC || h->version != BUNDLE_VERSION) return 0;
+    if (sizeof(BundleHeader) + (size_t)h->entry_count * sizeof(BundleEntry) > size) return 0;
+    const BundleEntry* e = (const BundleEntry*)(data + sizeof(BundleHeader));
+    for (uint32_t i = 0; i < h->entry_count; i++) {
+        if (e[i].offset > size || e[i].size > size - e[i].offset) return 0;
+    }
+    return 1;
+}
+
+#ifndef _WIN32
+static int bundle_map(const char* path) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return 0;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) { close(fd); return 0; }
+    void* base = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) return 0;
+    if (!bundle_validate(base, st.st_size)) {
+        printf(" Warning: Bundle invalide : %s\n", path);
+        munmap(base, st.st_size);
+        return 0;
+    }
+    bundle_data = base;
+    bundle_size = st.st_size;
+    bundle_mapped = 1;
+    return 1;
+}
+#else
+static int bundle_map(const char* path) { (void)path; return 0; }
+#endif
+
+int bundle_open() {
+    if (bundle_data) return 1;
+    bundle_tried = 1;
+#ifdef EMBED_ASSETS
+    if (bundle_validate(embedded_bundle, embedded_bundle_end - embedded_bundle)) {
+        bundle_data = embedded_bundle;
+        bundle_size = embedded_bundle_end - embedded_bundle;
+        return 1;
+    }
+#endif
+    char path[512];
+    const char* base = SDL_GetBasePath();
+    if (base) {
+        snprintf(path, sizeof(path), "%s%s", base, BUNDLE_FILE);
+        if (bundle_map(path)) return 1;
+    }
+    return bundle_map(BUNDLE_FILE);
+}
+
+/**
+ * @brief Repli sans bundle : charge assets/<nom> (dossier de l'exécutable puis dossier courant).
+ */
+static const void* bundle_load_loose(const char* name, size_t* size) {
+    for (int i = 0; i < loose_count; i++) {
+        if (strcmp(loose_files[i].name, name) == 0) { *size = loose_files[i].size; return loose_files[i].data; }
+    }
+    if (loose_count >= MAX_LOOSE_FILES) return NULL;
+
+    char path[512];
+    void* data = NULL;
+    const char* base = SDL_GetBasePath();
+    if (base) {
+        snprintf(path, sizeof(path), "%sassets/%s", base, name);
+        data = SDL_LoadFile(path, size);
+    }
+    if (!data) {
+        snprintf(path, sizeof(path), "assets/%s", name);
+        data = SDL_LoadFile(path, size);
+    }
+    if (!data) return NULL;
+
+    LooseFile* f = &loose_files[loose_count++];
+    snprintf(f->name, sizeof(f->name), "%s", name);
+    f->data = data;
+    f->size = *size;
+    return data;
+}
+
+const void* bundle_get(const char* name, size_t* size) {
+    if (!bundle_tried) bundle_open();
+    if (bundle_data) {
+        const BundleHeader* h = (const BundleHeader*)bundle_data;
+        const BundleEntry* e = (const BundleEntry*)(bundle_data + sizeof(BundleHeader));
+        for (uint32_t i = 0; i < h->entry_count; i++) {
+            if (strncmp(e[i].name, name, BUNDLE_NAME_MAX) == 0) {
+                *size = e[i].size;
+                return bundle_data + e[i].offset;
+            }
+        }
+        return NULL;
+    }
+    return bundle_load_loose(name, size);
+}
+
+void bundle_close() {
+#ifndef _WIN32
+    if (bundle_mapped) munmap((void*)bundle_data, bundle_size);
+#endif
+    bundle_data = NULL;
+    bundle_size = 0;
+    bundle_mapped = 0;
+    bundle_tried = 0;
+    for (int i = 0; i < loose_count; i++) SDL_free(loose_files[i].data);
+    loose_count = 0;
+}
@@ -0,0 +1,39 @@
+/**
+ * @file bundle.h
+ * @brief Bundle d'assets unique (sons WAV + atlas), lu par un seul mmap ou embarqué dans l'exécutable.
+ * @details Format : BundleHeader, table de BundleEntry, puis données alignées sur BUNDLE_ALIGN octets.
+ *          Le fichier est produit par l'outil tools/pack_assets (cible `make bundle`).
+ */
+
+#ifndef BUNDLE_H
+#define BUNDLE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define BUNDLE_FILE "assets.bundle"
+#define BUNDLE_MAGIC 0x4E424953u // "SIBN"
+#define BUNDLE_VERSION 1
+#define BUNDLE_ALIGN 64
+#define BUNDLE_NAME_MAX 32
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t entry_count;
+    uint32_t reserved;
+} BundleHeader;
+
+typedef struct {
+    char name[BUNDLE_NAME_MAX]; // Ex : "shoot.wav", "atlas"
+    uint64_t offset;            // Depuis le début du bundle, multiple de BUNDLE_ALIGN
+    uint64_t size;
+} BundleEntry;
+
+int bundle_open(); // Facultatif : bundle_get() l'appelle au premier accès
+void bundle_close();
+
+// Retourne les données de l'entrée (NULL si absente). Sans bundle, lit assets/<name> à la place.
+const void* bundle_get(const char* name, size_t* size);
+
+#endif
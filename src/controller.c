@@ -15,7 +15,12 @@
 #include "view_ncurses.h" 
 #include "view_sdl.h"     
 #include "audio.h" 
+#include "timings.h"
+#include "profiler.h"
 #include "model.h"
+#include "rewind.h"
+#include "replay.h"
+#include "highscore.h"
 
 #ifndef _WIN32
     #include <unistd.h>
@@ -76,26 +81,172 @@ void draw_big_text_centered(int y_offset, const char* text) {
     } 
 }
 
-void spawn_wave(GameState* s) {
-    s->enemy_count = 30;
-    s->enemy_direction = 1;
-    for (int i = 0; i < s->enemy_count; i++) {
-        s->enemies[i].active = 1;
-        s->enemies[i].alive = 1;
-        s->enemies[i].pos.x = (GAME_WIDTH - 540) / 2 + (i % 10) * 60;
-        s->enemies[i].pos.y = 50 + (i / 10) * 50;
+// --- BOT ---
+
+static Bot* active_bot = NULL;
+
+void controller_set_bot(Bot* bot) { active_bot = bot; }
+
+/**
+ * @brief Affiche le bilan du bot et arrête ses threads (avant SDL_Quit, qui les signalerait comme fuites).
+ */
+static void controller_release_bot() {
+    if (!active_bot) return;
+    BotStats stats;
+    bot_get_stats(active_bot, &stats);
+    printf("Bot MCTS : %llu coups, %llu rollouts, %.2f ms de recherche par coup\n", (unsigned long long)stats.decisions,
+           (unsigned long long)stats.rollouts, stats.decisions ? stats.search_ms / stats.decisions : 0.0);
+    bot_destroy(active_bot);
+    active_bot = NULL;
+}
+
+// --- RETOUR ARRIÈRE ---
+
+static RewindBuffer rewind_buffer;
+static const char* flight_recorder_path = NULL;
+
+void controller_set_flight_recorder(const char* path) { flight_recorder_path = path; }
+
+// --- REPLAYS ---
+
+#define REPLAY_SCRUB_TICKS 30 // Défilement par frame avec Gauche/Droite pendant la lecture
+
+static Replay* active_replay = NULL;
+static ReplayCursor replay_cursor;
+static const char* record_path = NULL;
+static ReplayWriter* recorder = NULL;
+
+void controller_set_replay(Replay* replay) { active_replay = replay; }
+void controller_set_record(const char* path) { record_path = path; }
+
+/**
+ * @brief Repart d'un état canonique avec une graine neuve : le replay se rejoue depuis cette seule graine.
+ */
+static void start_recording(GameState* s) {
+    uint64_t seed = ((uint64_t)time(NULL) << 32) ^ SDL_GetPerformanceCounter();
+    replay_start_state(s, seed, s->settings.player_speed);
+    replay_writer_destroy(recorder);
+    recorder = replay_writer_create(seed, s->settings.player_speed, REPLAY_KEYFRAME_INTERVAL);
+}
+
+/**
+ * @brief Déplace la lecture du replay ; s'il ne se relit pas jusque-là, la lecture s'arrête (fin de la boucle de jeu).
+ */
+static int seek_replay(GameState* s, uint64_t tick) {
+    if (replay_seek(active_replay, tick, s, &replay_cursor)) return 1;
+    printf("Replay illisible au tick %llu : lecture interrompue\n", (unsigned long long)replay_cursor.tick);
+    s->game_over = 2;
+    return 0;
+}
+
+static void finish_recording(const GameState* s) {
+    if (!recorder) return;
+    if (replay_writer_save(recorder, s, record_path)) printf("Replay enregistré dans %s (score %d)\n", record_path, s->score);
+    else printf("Impossible d'écrire le replay %s\n", record_path);
+    replay_writer_destroy(recorder);
+    recorder = NULL;
+}
+
+// --- MEILLEURS SCORES ---
+
+static HighScoreTable* high_scores = NULL;
+static long last_rank = 0, last_total = 0;
+static int score_recorded = 0; // Partie en cours déjà inscrite
+
+/**
+ * @brief Inscrit la partie terminée au tableau des scores (pas les replays relus, déjà joués).
+ * @details Une seule inscription par partie : après un retour arrière depuis le game over, la mort
+ *          suivante garde le rang déjà inscrit (remis à zéro par restart_game).
+ */
+static void record_high_score(const GameState* s) {
+    if (score_recorded) { view_sdl_set_rank(last_rank, last_total); return; }
+    score_recorded = 1;
+    last_rank = last_total = 0;
+    if (high_scores && !active_replay) {
+        HighScore entry;
+        const char* user = getenv("USER");
+        highscore_entry(&entry, s->score, s->level, active_bot ? "bot-mcts" : (user ? user : "joueur"));
+        last_rank = highscore_insert(high_scores, &entry);
+        last_total = highscore_count(high_scores);
     }
-    for (int i = 0; i < MAX_ENEMY_SHOTS; i++) s->enemy_shots[i].active = 0;
+    view_sdl_set_rank(last_rank, last_total);
+}
+
+/**
+ * @brief Nouvelle partie : l'historique de retour arrière appartient à la partie précédente.
+ */
+static void restart_game(GameState* s) {
+    if (active_replay) seek_replay(s, 0);
+    else if (record_path) { finish_recording(s); start_recording(s); }
+    else model_new_game(s, &s->rules);
+    rewind_clear(&rewind_buffer);
+    score_recorded = 0;
+}
+
+// --- BASCULE SDL <-> NCURSES ---
+
+// Latence des bascules de vue (compteur haute résolution SDL)
+static int switch_count = 0;
+static Uint64 switch_total_ticks = 0;
+static Uint64 switch_max_ticks = 0;
+
+/**
+ * @brief Bascule entre SDL et Ncurses sans détruire SDL, le renderer ni les sons chargés.
+ * @details La fenêtre est masquée/réaffichée et l'audio mis en pause : la bascule tient dans une frame.
+ */
+void controller_switch_mode(GameState* s, ViewMode* mode) {
+    Uint64 start = SDL_GetPerformanceCounter();
+    if (*mode == VIEW_MODE_SDL) {
+        audio_pause();
+        view_sdl_hide();
+        *mode = VIEW_MODE_NCURSES;
+        view_ncurses_init();
+    } else {
+        view_ncurses_shutdown();
+        *mode = VIEW_MODE_SDL;
+        view_sdl_init();
+        audio_init();
+        audio_set_volume(s->settings.volume);
+        audio_resume();
+    }
+    Uint64 elapsed = SDL_GetPerformanceCounter() - start;
+    switch_count++;
+    switch_total_ticks += elapsed;
+    if (elapsed > switch_max_ticks) switch_max_ticks = elapsed;
+}
+
+void controller_print_switch_stats() {
+    if (switch_count == 0) return;
+    double freq = (double)SDL_GetPerformanceFrequency();
+    printf("Bascule de vue : %d fois, moyenne %.3f ms, max %.3f ms\n", switch_count,
+           (switch_total_ticks * 1000.0 / freq) / switch_count, switch_max_ticks * 1000.0 / freq);
+}
+
+/**
+ * @brief Transmet les événements du tick au mixeur audio (file non bloquante) puis vide le tampon.
+ * @details Chaque kill du tick produit son propre son, même s'il y en a plusieurs.
+ */
+void controller_dispatch_events(GameState* s, ViewMode m) {
+    if (m == VIEW_MODE_SDL) {
+        for (int i = 0; i < s->event_count; i++) {
+            switch (s->events[i].type) {
+                case EVENT_SHOT_FIRED: audio_play(SOUND_SHOOT); break;
+                case EVENT_ENEMY_KILLED: audio_play(SOUND_ENEMY_DIE); break;
+                case EVENT_UFO_KILLED: audio_play(SOUND_UFO_DIE); break;
+                case EVENT_GAME_OVER: audio_play(SOUND_GAME_OVER); break;
+                default: break;
+            }
+        }
+    }
+    model_clear_events(s);
 }
 
 void controller_handle_input(GameState* s, InputType i, ViewMode m) {
+    (void)m;
     switch (i) {
         case INPUT_LEFT: model_move_left(s); break;
         case INPUT_RIGHT: model_move_right(s); break;
-        case INPUT_SHOOT: 
-            model_shoot(s); 
-            if (m == VIEW_MODE_SDL) audio_play(SOUND_SHOOT); 
-            break;
+        case INPUT_SHOOT: model_shoot(s); break;
         case INPUT_QUIT: s->game_over = 2; break;
         default: break;
     }
@@ -118,12 +269,9 @@ void show_ncurses_pause_menu(GameState* state, ViewMode* mode, int* paused) {
         int ch = getch();
         if (ch == ' ' || ch == 27) { *paused = 0; break; }
         else if (ch == 'q' || ch == 'Q') { state->game_over = 2; *paused = 0; break; }
-        else if (ch == 'r' || ch == 'R') { model_init(state); spawn_wave(state); *paused = 0; break; }
+        else if (ch == 'r' || ch == 'R') { restart_game(state); *paused = 0; break; }
         else if (ch == 't' || ch == 'T') {
-            view_ncurses_shutdown();
-            *mode = VIEW_MODE_SDL;
-            view_sdl_init();
-            audio_init();
+            controller_switch_mode(state, mode);
             *paused = 0;
             return;
         }
@@ -144,6 +292,7 @@ void show_ncurses_game_over_menu(GameState* state, ViewMode* mode) {
     attron(A_BOLD);
     mvprintw((max_y / 2) + 2, (max_x / 2) - 10, "SCORE FINAL : %d", state->score);
     attroff(A_BOLD);
+    if (last_rank > 0) mvprintw((max_y / 2) + 3, (max_x / 2) - 10, "RANG : %ld / %ld", last_rank, last_total);
     mvprintw((max_y / 2) + 5, (max_x / 2) - 15, "[R] Recommencer");
     mvprintw((max_y / 2) + 6, (max_x / 2) - 15, "[T] Mode SDL");
     mvprintw((max_y / 2) + 7, (max_x / 2) - 15, "[Q] Quitter");
@@ -152,14 +301,10 @@ void show_ncurses_game_over_menu(GameState* state, ViewMode* mode) {
     while (1) {
         int ch = getch();
         if (ch == 'q' || ch == 'Q') { state->game_over = 2; break; }
-        else if (ch == 'r' || ch == 'R') { model_init(state); spawn_wave(state); break; }
+        else if (ch == 'r' || ch == 'R') { restart_game(state); break; }
         else if (ch == 't' || ch == 'T') {
-            view_ncurses_shutdown();
-            *mode = VIEW_MODE_SDL;
-            view_sdl_init();
-            audio_init();
-            model_init(state);
-            spawn_wave(state);
+            controller_switch_mode(state, mode);
+            restart_game(state);
             break;
         }
     }
@@ -170,22 +315,30 @@ void show_ncurses_game_over_menu(GameState* state, ViewMode* mode) {
 
 void controller_run(GameState* state, ViewMode mode) {
     srand(time(NULL));
-    model_init(state);
+    model_seed(state, (uint64_t)time(NULL));
+    model_new_game(state, &state->rules); // Règles fixées par main (graine des niveaux procéduraux)
     model_init_save_system(); 
+    high_scores = highscore_open(HIGHSCORE_PATH);
+    if (rewind_init(&rewind_buffer, REWIND_SECONDS * REWIND_TICKS_PER_SECOND, REWIND_KEYFRAME_INTERVAL)) {
+        rewind_install_crash_dump(&rewind_buffer, REWIND_DUMP_PATH);
+    }
     
     if (mode == VIEW_MODE_MENU) {
         mode = view_sdl_show_launcher(state);
     }
 
     if (mode == VIEW_MODE_QUIT) {
-        SDL_Quit(); 
+        rewind_destroy(&rewind_buffer);
+        highscore_close(high_scores);
+        high_scores = NULL;
+        controller_release_bot();
+        audio_shutdown();
+        view_sdl_shutdown(); 
         return; 
     }
 
     if (mode == VIEW_MODE_SDL) { 
-        if (!SDL_WasInit(SDL_INIT_VIDEO)) {
-             if(!SDL_Init(SDL_INIT_VIDEO)) exit(1);
-        }
+        // Réutilise la fenêtre du launcher si elle existe déjà
         view_sdl_init(); 
         audio_init(); 
         audio_set_volume(state->settings.volume);
@@ -193,39 +346,78 @@ void controller_run(GameState* state, ViewMode mode) {
     else { 
         view_ncurses_init(); 
     }
-    
-    if (state->score == 0 && state->level == 1 && state->enemy_count == 0) { spawn_wave(state); }
-    
+
+
     int paused = 0;
+    if (active_replay) {
+        seek_replay(state, 0);
+    } else if (record_path) {
+        if (state->score == 0 && state->level == 1) start_recording(state);
+        else { printf("Partie chargée : pas d'enregistrement de replay\n"); record_path = NULL; }
+    }
+    if (flight_recorder_path) {
+        // Le tampon chargé remplace le tampon vide : on reprend en pause au moment du plantage
+        RewindBuffer loaded;
+        if (rewind_load(&loaded, state, flight_recorder_path)) {
+            rewind_destroy(&rewind_buffer);
+            rewind_buffer = loaded;
+            rewind_install_crash_dump(&rewind_buffer, REWIND_DUMP_PATH);
+            paused = 1;
+            printf("Enregistreur de vol %s : %d ticks (Retour arrière pour remonter)\n", flight_recorder_path, rewind_available(&rewind_buffer));
+        } else printf("Enregistreur de vol illisible : %s\n", flight_recorder_path);
+    }
+    
     int in_menu = 0; 
     int save_menu_open = 0;
-    int game_over_sound_played = 0;
+    int first_frame = 1;
+    Uint64 last_frame = SDL_GetPerformanceCounter();
+    double perf_freq = (double)SDL_GetPerformanceFrequency();
+    float tick_ms = 0;
 
     while (1) {
         if (state->game_over == 2) break;
         if (mode == VIEW_MODE_SDL) audio_update();
 
+        // Temps de frame (overlay F3) : intervalle entre deux débuts de frame
+        Uint64 frame_start = SDL_GetPerformanceCounter();
+        float frame_ms = (float)((frame_start - last_frame) * 1000.0 / perf_freq);
+        last_frame = frame_start;
+        tick_ms = 0;
+
+        PROFILE_BEGIN(prof_input, "entrees");
         InputType input;
         if (mode == VIEW_MODE_SDL && in_menu) input = view_sdl_menu_input(0);
         else input = (mode == VIEW_MODE_SDL) ? view_sdl_get_input(state) : view_ncurses_get_input();
+        PROFILE_END(prof_input);
 
         if (input == INPUT_QUIT) break;
         
         if (input == INPUT_SWITCH_MODE) {
-            if (mode == VIEW_MODE_SDL) { audio_shutdown(); view_sdl_shutdown(); mode = VIEW_MODE_NCURSES; view_ncurses_init(); } 
-            else { view_ncurses_shutdown(); mode = VIEW_MODE_SDL; view_sdl_init(); audio_init(); }
+            controller_switch_mode(state, &mode);
             continue; 
         }
 
+        if (input == INPUT_DEBUG_HUD) view_sdl_toggle_perf_overlay();
+
+        // Un tick en arrière par frame tant que la touche est maintenue (aussi depuis la pause ou le game over).
+        // Un replay en cours d'enregistrement ne peut pas être réécrit ; en lecture, on navigue dans le replay.
+        int scrubbed = input == INPUT_REWIND;
+        if (scrubbed && !save_menu_open && !active_replay && !record_path) rewind_step_back(&rewind_buffer, state);
+        if (active_replay && !save_menu_open && (input == INPUT_REWIND || input == INPUT_LEFT || input == INPUT_RIGHT)) {
+            uint64_t step = input == INPUT_REWIND ? 1 : REPLAY_SCRUB_TICKS, tick = replay_cursor.tick;
+            if (!seek_replay(state, input == INPUT_RIGHT ? tick + step : (tick > step ? tick - step : 0))) continue;
+            scrubbed = 1;
+        }
+
         if (state->game_over == 1) {
             if (mode == VIEW_MODE_NCURSES) { 
                 show_ncurses_game_over_menu(state, &mode); 
                 if (state->game_over == 2) break; 
-                game_over_sound_played = 0; continue; 
+                continue; 
             } 
             else { 
-                if (!game_over_sound_played) { audio_play(SOUND_GAME_OVER); game_over_sound_played = 1; } 
-                if (input == INPUT_RESTART) { model_init(state); spawn_wave(state); game_over_sound_played = 0; } 
+                if (input == INPUT_RESTART) { restart_game(state); } 
+                view_sdl_perf_sample(frame_ms, tick_ms);
                 view_sdl_render(state, paused, save_menu_open); 
                 SDL_Delay(16); continue; 
             }
@@ -241,27 +433,39 @@ void controller_run(GameState* state, ViewMode mode) {
             } 
             else { 
                 if (input == INPUT_SHOOT) paused = 0; 
-                if (input == INPUT_RESTART) { model_init(state); spawn_wave(state); paused = 0; } 
+                if (input == INPUT_RESTART) { restart_game(state); paused = 0; } 
                 if (input == INPUT_SAVE) save_menu_open = 1; 
             }
         }
 
-        if (!paused && !state->game_over) {
+        if (active_replay && !paused && !state->game_over && !scrubbed && !replay_cursor_next(&replay_cursor, &input)) paused = 1; // Fin du replay
+
+        if (!paused && !state->game_over && !scrubbed) {
+            PROFILE_BEGIN(prof_tick, "model_update");
+            Uint64 tick_start = SDL_GetPerformanceCounter();
+            if (active_bot && !active_replay && input <= INPUT_SHOOT) input = bot_choose(active_bot, state); // Les touches de menu restent au joueur
+            rewind_record(&rewind_buffer, state, input);
+            if (recorder) replay_writer_record(recorder, state, input);
             controller_handle_input(state, input, mode);
-            int old_score = state->score;
-            model_update(state);
-            if (state->score > old_score && mode == VIEW_MODE_SDL) audio_play(SOUND_ENEMY_DIE);
-            int active = 0; for(int i=0; i<state->enemy_count; i++) if(state->enemies[i].alive) active++;
-            if(active == 0) { state->level++; spawn_wave(state); }
+            model_tick(state);
+            if (state->game_over == 1) { finish_recording(state); record_high_score(state); }
+            controller_dispatch_events(state, mode);
+            tick_ms = (float)((SDL_GetPerformanceCounter() - tick_start) * 1000.0 / perf_freq);
+            PROFILE_END(prof_tick);
         }
 
         if (mode == VIEW_MODE_SDL) { 
+            view_sdl_perf_sample(frame_ms, tick_ms);
+            PROFILE_BEGIN(prof_render, "view_sdl_render");
             view_sdl_render(state, paused, save_menu_open); 
+            PROFILE_END(prof_render);
+            if (first_frame) { timings_mark("premiere frame"); first_frame = 0; }
             SDL_Delay(16); 
         } 
         else { 
             if (!paused) { 
                 view_ncurses_render(state); 
+                if (first_frame) { timings_mark("premiere frame"); first_frame = 0; }
 #ifdef _WIN32 
                 _sleep(30); 
 #else 
@@ -272,5 +476,14 @@ void controller_run(GameState* state, ViewMode mode) {
         }
     }
     
-    if (mode == VIEW_MODE_SDL) { audio_shutdown(); view_sdl_shutdown(); } else view_ncurses_shutdown();
+    // SDL a pu rester vivant (fenêtre masquée) même si l'on termine en mode texte
+    if (mode == VIEW_MODE_NCURSES) view_ncurses_shutdown();
+    finish_recording(state); // Partie interrompue : le replay s'arrête au dernier tick joué
+    rewind_destroy(&rewind_buffer);
+    highscore_close(high_scores);
+    high_scores = NULL;
+    controller_release_bot();
+    audio_shutdown(); 
+    view_sdl_shutdown();
+    controller_print_switch_stats();
 }
\ No newline at end of file
@@ -7,8 +7,25 @@
 #define CONTROLLER_H
 
 #include "model.h"
+#include "bot.h"
+#include "replay.h"
 
 // Lance la boucle principale du jeu
 void controller_run(GameState* state, ViewMode mode);
 
+// Confie les déplacements et tirs au bot (NULL : joueur humain) ; le contrôleur le détruit en fin de partie
+void controller_set_bot(Bot* bot);
+
+// Démarre sur un fichier de l'enregistreur de vol (rewind_dump) : la partie reprend au dernier tick enregistré
+void controller_set_flight_recorder(const char* path);
+
+// Lecture d'un replay à la place du joueur (Gauche/Droite : défilement, Retour arrière : tick précédent)
+void controller_set_replay(Replay* replay);
+
+// Enregistre chaque partie jouée dans path (écrasé à chaque nouvelle partie)
+void controller_set_record(const char* path);
+
+// Entrées joueur -> modèle, partagé avec les outils
+void controller_handle_input(GameState* s, InputType i, ViewMode m);
+
 #endif
\ No newline at end of file
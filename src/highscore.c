@@ -0,0 +1,297 @@
+/**
+ * @file highscore.c
+ * @brief Implémentation du tableau des scores (pages triées + répertoire, mmap partagé, flock).
+ * @details Disposition du fichier : en-tête (4 Ko), répertoire (HIGHSCORE_MAX_PAGES entrées, réservé d'emblée :
+ * le fichier est creux tant qu'il n'est pas écrit), puis les pages dans l'ordre de leur création. Le répertoire
+ * donne l'ordre des pages : l'entrée k décrit la k-ième page par score décroissant.
+ * Les rangs viennent d'un arbre de Fenwick des effectifs des pages, propre au handle (hors fichier) : mis à
+ * jour en O(log pages) par insertion, reconstruit après une coupure de page ou une écriture d'un autre handle.
+ */
+
+#define _DEFAULT_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "highscore.h"
+
+#ifndef _WIN32
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <sys/file.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+#endif
+
+#define HIGHSCORE_MAGIC 0x31534849u // "IHS1"
+#define HEADER_BYTES 4096
+#define PAGE_BYTES (HIGHSCORE_PAGE_RECORDS * sizeof(HighScore))
+#define DATA_OFFSET (HEADER_BYTES + HIGHSCORE_MAX_PAGES * sizeof(PageInfo))
+#define GROW_PAGES 16 // Pages ajoutées au fichier à chaque agrandissement
+
+_Static_assert(sizeof(HighScore) == 32, "HighScore fait partie du format de fichier");
+
+typedef struct {
+    uint32_t magic;
+    uint32_t record_size;
+    uint32_t page_records;
+    uint32_t page_count;      // Pages utilisées (dans le répertoire)
+    uint32_t page_capacity;   // Pages allouées dans le fichier
+    uint32_t reserved;
+    uint64_t total;           // Nombre de scores
+} HighScoreHeader;
+
+typedef struct {
+    uint32_t page;            // Numéro de la page dans la zone de données
+    uint32_t count;
+    int32_t first;            // Meilleur score de la page
+    int32_t last;             // Plus petit score de la page
+} PageInfo;
+
+void highscore_entry(HighScore* entry, int score, int level, const char* name) {
+    memset(entry, 0, sizeof(*entry));
+    entry->score = score;
+    entry->level = level;
+    entry->time = (int64_t)time(NULL);
+    snprintf(entry->name, sizeof(entry->name), "%s", name ? name : "");
+}
+
+#ifndef _WIN32
+
+struct HighScoreTable {
+    int fd;
+    unsigned char* base;
+    size_t mapped;
+    uint32_t* tree;           // Arbre de Fenwick des effectifs du répertoire (indices 1 à tree_pages, place pour toutes les pages)
+    uint64_t tree_total;      // header->total lors de la dernière mise à jour (autre valeur : arbre à reconstruire)
+    uint32_t tree_pages;
+};
+
+static HighScoreHeader* header(HighScoreTable* t) { return (HighScoreHeader*)t->base; }
+static PageInfo* directory(HighScoreTable* t) { return (PageInfo*)(t->base + HEADER_BYTES); }
+static HighScore* page_records(HighScoreTable* t, uint32_t page) { return (HighScore*)(t->base + DATA_OFFSET + (size_t)page * PAGE_BYTES); }
+
+/**
+ * @brief Suit la taille du fichier (un autre processus a pu l'agrandir). À appeler verrou pris.
+ */
+static int remap(HighScoreTable* t) {
+    struct stat st;
+    if (fstat(t->fd, &st) != 0) return 0;
+    if ((size_t)st.st_size == t->mapped) return 1;
+    if (t->base) munmap(t->base, t->mapped);
+    t->base = mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, t->fd, 0);
+    if (t->base == MAP_FAILED) { t->base = NULL; t->mapped = 0; return 0; }
+    t->mapped = st.st_size;
+    return 1;
+}
+
+static int lock(HighScoreTable* t, int mode) {
+    if (flock(t->fd, mode) != 0) return 0;
+    if (remap(t)) return 1;
+    flock(t->fd, LOCK_UN);
+    return 0;
+}
+
+static void unlock(HighScoreTable* t) { flock(t->fd, LOCK_UN); }
+
+// Ajoute delta à l'effectif de la k-ième page du répertoire (arbre sur les tree_pages premières pages)
+static void tree_add(HighScoreTable* t, uint32_t k, int delta) {
+    for (uint32_t i = k + 1; i <= t->tree_pages; i += i & -i) t->tree[i] += delta;
+}
+
+// Nombre de scores dans les k premières pages du répertoire
+static long tree_prefix(const HighScoreTable* t, uint32_t k) {
+    long sum = 0;
+    for (uint32_t i = k; i > 0; i -= i & -i) sum += t->tree[i];
+    return sum;
+}
+
+/**
+ * @brief Reconstruit l'arbre en O(pages) si le répertoire a changé hors de ce handle. À appeler verrou pris.
+ * @details L'arbre ne couvre que les page_count pages : un nouveau nombre de pages impose de toute façon
+ *          une reconstruction, les indices au-delà ne sont donc jamais lus.
+ */
+static void tree_sync(HighScoreTable* t) {
+    const HighScoreHeader* h = header(t);
+    if (t->tree_total == h->total && t->tree_pages == h->page_count) return;
+    const PageInfo* dir = directory(t);
+    uint32_t n = h->page_count;
+    memset(t->tree, 0, (n + 1) * sizeof(uint32_t));
+    for (uint32_t i = 1; i <= n; i++) {
+        t->tree[i] += dir[i - 1].count;
+        uint32_t parent = i + (i & -i);
+        if (parent <= n) t->tree[parent] += t->tree[i];
+    }
+    t->tree_total = h->total;
+    t->tree_pages = h->page_count;
+}
+
+HighScoreTable* highscore_open(const char* path) {
+    HighScoreTable* t = calloc(1, sizeof(HighScoreTable));
+    if (!t) return NULL;
+    t->tree_total = UINT64_MAX; // Construit au premier accès
+    t->tree = malloc((HIGHSCORE_MAX_PAGES + 1) * sizeof(uint32_t));
+    t->fd = t->tree ? open(path, O_RDWR | O_CREAT, 0644) : -1;
+    if (t->fd < 0 || flock(t->fd, LOCK_EX) != 0) { highscore_close(t); return NULL; }
+
+    struct stat st;
+    int ok = fstat(t->fd, &st) == 0;
+    if (ok && st.st_size == 0) { // Nouveau fichier : en-tête seul, répertoire et données creux
+        HighScoreHeader h = { HIGHSCORE_MAGIC, sizeof(HighScore), HIGHSCORE_PAGE_RECORDS, 0, 0, 0, 0 };
+        ok = ftruncate(t->fd, DATA_OFFSET) == 0 && pwrite(t->fd, &h, sizeof(h), 0) == (ssize_t)sizeof(h);
+    }
+    ok = ok && remap(t) && t->mapped >= DATA_OFFSET;
+    if (ok) {
+        HighScoreHeader* h = header(t);
+        ok = h->magic == HIGHSCORE_MAGIC && h->record_size == sizeof(HighScore) && h->page_records == HIGHSCORE_PAGE_RECORDS
+          && DATA_OFFSET + (size_t)h->page_capacity * PAGE_BYTES <= t->mapped;
+    }
+    unlock(t);
+    if (!ok) { highscore_close(t); return NULL; }
+    return t;
+}
+
+void highscore_close(HighScoreTable* t) {
+    if (!t) return;
+    if (t->base) munmap(t->base, t->mapped);
+    if (t->fd >= 0) close(t->fd);
+    free(t->tree);
+    free(t);
+}
+
+/**
+ * @brief Nouvelle page vide dans la zone de données (agrandit le fichier par blocs de GROW_PAGES).
+ */
+static int new_page(HighScoreTable* t, uint32_t* page) {
+    HighScoreHeader* h = header(t);
+    if (h->page_count >= HIGHSCORE_MAX_PAGES) return 0;
+    if (h->page_count == h->page_capacity) {
+        uint32_t capacity = h->page_capacity + GROW_PAGES;
+        if (capacity > HIGHSCORE_MAX_PAGES) capacity = HIGHSCORE_MAX_PAGES;
+        if (ftruncate(t->fd, DATA_OFFSET + (off_t)capacity * PAGE_BYTES) != 0 || !remap(t)) return 0;
+        h = header(t);
+        h->page_capacity = capacity;
+    }
+    *page = h->page_count; // Les pages ne sont jamais libérées : numéro = rang de création
+    return 1;
+}
+
+static void refresh_bounds(HighScoreTable* t, PageInfo* info) {
+    const HighScore* r = page_records(t, info->page);
+    info->first = r[0].score;
+    info->last = r[info->count - 1].score;
+}
+
+// Premier enregistrement de la page dont le score est < score (insertion après les égaux)
+static uint32_t upper_bound(const HighScore* r, uint32_t count, int score) {
+    uint32_t lo = 0, hi = count;
+    while (lo < hi) { uint32_t mid = (lo + hi) / 2; if (r[mid].score >= score) lo = mid + 1; else hi = mid; }
+    return lo;
+}
+
+// Premier enregistrement de la page dont le score est <= score
+static uint32_t lower_bound(const HighScore* r, uint32_t count, int score) {
+    uint32_t lo = 0, hi = count;
+    while (lo < hi) { uint32_t mid = (lo + hi) / 2; if (r[mid].score > score) lo = mid + 1; else hi = mid; }
+    return lo;
+}
+
+long highscore_insert(HighScoreTable* t, const HighScore* entry) {
+    if (!t || !lock(t, LOCK_EX)) return 0;
+    HighScoreHeader* h = header(t);
+    long rank = 0;
+
+    if (h->page_count == 0) { // Premier score
+        uint32_t page;
+        if (!new_page(t, &page)) goto done;
+        h = header(t);
+        directory(t)[0] = (PageInfo){ page, 0, 0, 0 };
+        h->page_count = 1;
+    }
+
+    tree_sync(t);
+
+    // Page cible : la première dont le plus petit score est battu (sinon la dernière)
+    PageInfo* dir = directory(t);
+    uint32_t lo = 0, hi = h->page_count - 1;
+    while (lo < hi) { uint32_t mid = (lo + hi) / 2; if (dir[mid].last >= entry->score) lo = mid + 1; else hi = mid; }
+    uint32_t k = lo;
+
+    if (dir[k].count == HIGHSCORE_PAGE_RECORDS) { // Page pleine : la moitié basse part dans une nouvelle page
+        uint32_t page;
+        if (!new_page(t, &page)) goto done;
+        h = header(t);
+        dir = directory(t);
+        uint32_t half = HIGHSCORE_PAGE_RECORDS / 2;
+        memcpy(page_records(t, page), page_records(t, dir[k].page) + half, (HIGHSCORE_PAGE_RECORDS - half) * sizeof(HighScore));
+        memmove(&dir[k + 2], &dir[k + 1], (h->page_count - k - 1) * sizeof(PageInfo));
+        dir[k + 1] = (PageInfo){ page, HIGHSCORE_PAGE_RECORDS - half, 0, 0 };
+        dir[k].count = half;
+        h->page_count++;
+        refresh_bounds(t, &dir[k]);
+        refresh_bounds(t, &dir[k + 1]);
+        if (dir[k].last >= entry->score) k++;
+        tree_sync(t); // page_count a changé : reconstruction, une coupure toutes les 128 insertions au plus
+    }
+
+    HighScore* r = page_records(t, dir[k].page);
+    uint32_t pos = upper_bound(r, dir[k].count, entry->score);
+    memmove(&r[pos + 1], &r[pos], (dir[k].count - pos) * sizeof(HighScore));
+    r[pos] = *entry;
+    dir[k].count++;
+    refresh_bounds(t, &dir[k]);
+    h->total++;
+    tree_add(t, k, 1);
+    t->tree_total = h->total;
+
+    rank = tree_prefix(t, k) + pos + 1;
+done:
+    unlock(t);
+    return rank;
+}
+
+long highscore_count(HighScoreTable* t) {
+    if (!t || !lock(t, LOCK_SH)) return 0;
+    long count = (long)header(t)->total;
+    unlock(t);
+    return count;
+}
+
+long highscore_top(HighScoreTable* t, HighScore* out, long k) {
+    if (!t || !lock(t, LOCK_SH)) return 0;
+    HighScoreHeader* h = header(t);
+    PageInfo* dir = directory(t);
+    long copied = 0;
+    for (uint32_t i = 0; i < h->page_count && copied < k; i++) {
+        long n = dir[i].count < (uint32_t)(k - copied) ? (long)dir[i].count : k - copied;
+        memcpy(out + copied, page_records(t, dir[i].page), n * sizeof(HighScore));
+        copied += n;
+    }
+    unlock(t);
+    return copied;
+}
+
+long highscore_rank(HighScoreTable* t, int score) {
+    if (!t || !lock(t, LOCK_SH)) return 0;
+    HighScoreHeader* h = header(t);
+    PageInfo* dir = directory(t);
+    tree_sync(t);
+    // Première page dont le plus petit score n'est pas strictement supérieur
+    uint32_t lo = 0, hi = h->page_count;
+    while (lo < hi) { uint32_t mid = (lo + hi) / 2; if (dir[mid].last > score) lo = mid + 1; else hi = mid; }
+    long rank = 1 + tree_prefix(t, lo);
+    if (lo < h->page_count) rank += lower_bound(page_records(t, dir[lo].page), dir[lo].count, score);
+    unlock(t);
+    return rank;
+}
+
+#else
+
+HighScoreTable* highscore_open(const char* path) { (void)path; return NULL; }
+void highscore_close(HighScoreTable* t) { (void)t; }
+long highscore_insert(HighScoreTable* t, const HighScore* entry) { (void)t; (void)entry; return 0; }
+long highscore_count(HighScoreTable* t) { (void)t; return 0; }
+long highscore_top(HighScoreTable* t, HighScore* out, long k) { (void)t; (void)out; (void)k; return 0; }
+long highscore_rank(HighScoreTable* t, int score) { (void)t; (void)score; return 0; }
+
+#endif
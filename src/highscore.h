@@ -0,0 +1,55 @@
+/**
+ * @file highscore.h
+ * @brief Tableau des meilleurs scores : fichier d'enregistrements fixes, trié, projeté en mémoire (mmap).
+ * @details Le fichier est l'index : aucun chargement ni analyse à l'ouverture, les requêtes lisent
+ *          directement la projection. Les scores sont rangés par ordre décroissant (à score égal, le plus
+ *          ancien d'abord) dans des pages de HIGHSCORE_PAGE_RECORDS enregistrements, chaînées par un
+ *          répertoire trié (premier et dernier score, effectif de chaque page). Une insertion fait deux
+ *          recherches dichotomiques (répertoire, page), décale au plus une page et obtient son rang d'un
+ *          arbre de Fenwick des effectifs (O(log pages)). Une page pleine est coupée en deux : le répertoire
+ *          est alors décalé et l'arbre reconstruit, en O(pages), au plus une fois toutes les 128 insertions.
+ *          Plusieurs processus (parties headless en parallèle) peuvent écrire : chaque
+ *          opération prend un verrou flock (exclusif pour insérer, partagé pour lire) et reprojette le
+ *          fichier s'il a grandi ; l'arbre est alors reconstruit (O(pages)) à l'opération suivante.
+ *          Un handle n'est utilisable que par un thread à la fois : sa projection et son arbre changent
+ *          même pendant une lecture. Des threads ouvrent chacun leur handle (flock sépare les handles).
+ */
+
+#ifndef HIGHSCORE_H
+#define HIGHSCORE_H
+
+#include <stdint.h>
+
+#define HIGHSCORE_PATH "saves/highscores.bin"
+#define HIGHSCORE_NAME_SIZE 16
+#define HIGHSCORE_PAGE_RECORDS 256   // Décalage maximal d'une insertion : 8 Ko
+#define HIGHSCORE_MAX_PAGES 65536    // 16,7 millions de scores
+
+typedef struct {
+    int32_t score;
+    int32_t level;
+    int64_t time;                    // Date de la partie (time())
+    char name[HIGHSCORE_NAME_SIZE];  // Terminé par '\0'
+} HighScore;
+
+typedef struct HighScoreTable HighScoreTable;
+
+// Ouvre (ou crée) le tableau ; NULL si le fichier est illisible ou d'un autre format
+HighScoreTable* highscore_open(const char* path);
+void highscore_close(HighScoreTable* table);
+
+// Insère un score et renvoie son rang (1 : meilleur score), 0 en cas d'erreur ou de tableau plein
+long highscore_insert(HighScoreTable* table, const HighScore* entry);
+
+long highscore_count(HighScoreTable* table);
+
+// Copie les k meilleurs scores dans out ; renvoie le nombre copié
+long highscore_top(HighScoreTable* table, HighScore* out, long k);
+
+// Rang qu'obtiendrait ce score (1 + nombre de scores strictement supérieurs)
+long highscore_rank(HighScoreTable* table, int score);
+
+// Remplit une entrée avec la date courante et le nom donné (tronqué)
+void highscore_entry(HighScore* entry, int score, int level, const char* name);
+
+#endif
@@ -0,0 +1,183 @@
+/**
+ * @file invaders.c
+ * @brief Implémentation de libinvaders : lot de GameState avancés par model_tick.
+ * @details Seules les fonctions marquées INV_API sont exportées (la bibliothèque est compilée en -fvisibility=hidden).
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "invaders.h"
+#include "model.h"
+#include "raster.h"
+#include "waves.h"
+#include "behavior.h"
+
+_Static_assert(INV_FEATURE_ENEMIES == MAX_ENEMIES
+               && INV_FEATURE_SIZE == 9 + MAX_ENEMIES * 4 + MAX_SHOTS * 3 + MAX_ENEMY_SHOTS * 3 + MAX_SHIELDS,
+               "INV_FEATURE_SIZE ne correspond plus au GameState");
+
+struct InvEnv {
+    int num_envs;
+    GameState* states;
+    uint8_t* pending_reset; // Parties terminées, réinitialisées au prochain tick
+    Raster* raster;         // NULL tant que les pixels ne sont pas activés
+};
+
+static int valid_index(const InvEnv* env, int index) {
+    return env && index >= 0 && index < env->num_envs;
+}
+
+INV_API int inv_abi_version(void) { return INV_ABI_VERSION; }
+
+// Copies des tables installées (waves_set et behavior_set ne copient pas)
+static void* waves_copy = NULL;
+static size_t waves_copy_size = 0;
+static void* behaviors_copy = NULL;
+
+static void* copy_table(const void* data, size_t size) {
+    void* copy = malloc(size ? size : 1);
+    if (copy) memcpy(copy, data, size);
+    return copy;
+}
+
+INV_API int inv_load_tables(const void* waves, size_t waves_size, const void* behaviors, size_t behaviors_size) {
+    void* w = waves ? copy_table(waves, waves_size) : NULL;
+    void* b = behaviors ? copy_table(behaviors, behaviors_size) : NULL;
+    if ((waves && !w) || (behaviors && !b) || !waves_set(w, waves_size)) { free(w); free(b); return 0; }
+    if (!behavior_set(b, behaviors_size)) {
+        waves_set(waves_copy, waves_copy_size); // Les deux tables ou aucune
+        free(w); free(b);
+        return 0;
+    }
+    free(waves_copy);
+    free(behaviors_copy);
+    waves_copy = w; waves_copy_size = waves_size;
+    behaviors_copy = b;
+    return 1;
+}
+
+INV_API int inv_table_hashes(uint64_t* waves_out, uint64_t* behaviors_out) {
+    if (waves_out) *waves_out = waves_hash();
+    if (behaviors_out) *behaviors_out = behavior_hash();
+    return 1;
+}
+
+INV_API InvEnv* inv_create(int num_envs) {
+    if (num_envs <= 0) return NULL;
+    InvEnv* env = calloc(1, sizeof(InvEnv));
+    if (!env) return NULL;
+    env->num_envs = num_envs;
+    env->states = calloc(num_envs, sizeof(GameState));
+    env->pending_reset = calloc(num_envs, 1);
+    if (!env->states || !env->pending_reset) { inv_destroy(env); return NULL; }
+    inv_seed(env, 0);
+    return env;
+}
+
+INV_API void inv_destroy(InvEnv* env) {
+    if (!env) return;
+    raster_destroy(env->raster);
+    free(env->states);
+    free(env->pending_reset);
+    free(env);
+}
+
+INV_API int inv_num_envs(const InvEnv* env) { return env ? env->num_envs : 0; }
+
+INV_API int inv_seed(InvEnv* env, uint64_t seed) {
+    if (!env) return 0;
+    for (int i = 0; i < env->num_envs; i++) {
+        model_seed(&env->states[i], seed + (uint64_t)i);
+        model_reset_game(&env->states[i]);
+        env->pending_reset[i] = 0;
+    }
+    return 1;
+}
+
+INV_API int inv_reset(InvEnv* env, int index) {
+    if (!env) return 0;
+    if (index < 0) {
+        for (int i = 0; i < env->num_envs; i++) { model_reset_game(&env->states[i]); env->pending_reset[i] = 0; }
+        return 1;
+    }
+    if (!valid_index(env, index)) return 0;
+    model_reset_game(&env->states[index]);
+    env->pending_reset[index] = 0;
+    return 1;
+}
+
+INV_API int inv_step(InvEnv* env, const int32_t* actions, int num_steps, float* rewards, uint8_t* dones) {
+    if (!env || !actions || num_steps < 0) return 0;
+    int n = env->num_envs;
+    for (int step = 0; step < num_steps; step++) {
+        for (int i = 0; i < n; i++) {
+            GameState* s = &env->states[i];
+            if (env->pending_reset[i]) { model_reset_game(s); env->pending_reset[i] = 0; }
+            float reward = model_step_action(s, actions[(size_t)step * n + i]);
+            env->pending_reset[i] = s->game_over != 0;
+            if (rewards) rewards[(size_t)step * n + i] = reward;
+            if (dones) dones[(size_t)step * n + i] = env->pending_reset[i];
+        }
+    }
+    return 1;
+}
+
+INV_API int inv_observe_features(const InvEnv* env, float* out) {
+    if (!env || !out) return 0;
+    for (int e = 0; e < env->num_envs; e++) {
+        const GameState* s = &env->states[e];
+        float* f = out + (size_t)e * INV_FEATURE_SIZE;
+        *f++ = s->pos.x; *f++ = s->pos.y; *f++ = s->lives; *f++ = s->level; *f++ = s->score;
+        *f++ = s->enemy_direction; *f++ = s->ufo.active; *f++ = s->ufo.x; *f++ = s->ufo.y;
+        for (int i = 0; i < MAX_ENEMIES; i++) {
+            int alive = i < s->enemy_count && s->enemies[i].alive;
+            *f++ = alive; *f++ = alive ? s->enemies[i].type : 0;
+            *f++ = alive ? s->enemies[i].pos.x : 0; *f++ = alive ? s->enemies[i].pos.y : 0;
+        }
+        for (int i = 0; i < MAX_SHOTS; i++) { *f++ = s->shots[i].active; *f++ = s->shots[i].pos.x; *f++ = s->shots[i].pos.y; }
+        for (int i = 0; i < MAX_ENEMY_SHOTS; i++) { *f++ = s->enemy_shots[i].active; *f++ = s->enemy_shots[i].pos.x; *f++ = s->enemy_shots[i].pos.y; }
+        for (int i = 0; i < MAX_SHIELDS; i++) *f++ = s->shields[i].active ? s->shields[i].health : 0;
+    }
+    return 1;
+}
+
+INV_API int inv_set_pixel_observation(InvEnv* env, int width, int height, int channels) {
+    if (!env || (channels != 1 && channels != 3)) return 0;
+    Raster* r = raster_create(width, height, channels == 1 ? RASTER_GRAY : RASTER_RGB);
+    if (!r) return 0;
+    raster_destroy(env->raster);
+    env->raster = r;
+    return 1;
+}
+
+INV_API int inv_observe_pixels(const InvEnv* env, uint8_t* out) {
+    if (!env || !env->raster || !out) return 0;
+    size_t frame = raster_frame_size(env->raster);
+    for (int i = 0; i < env->num_envs; i++) raster_draw(env->raster, &env->states[i], out + i * frame);
+    return 1;
+}
+
+INV_API size_t inv_state_size(void) { return sizeof(ModelSnapshot); }
+
+INV_API int inv_save_state(const InvEnv* env, int index, void* out) {
+    if (!valid_index(env, index) || !out) return 0;
+    model_snapshot(&env->states[index], (ModelSnapshot*)out);
+    return 1;
+}
+
+INV_API int inv_load_state(InvEnv* env, int index, const void* in) {
+    if (!valid_index(env, index) || !in) return 0;
+    ModelSnapshot snap; // Blob venu de l'appelant : copié (alignement quelconque) et contrôlé avant de le simuler
+    memcpy(&snap, in, sizeof(snap));
+    if (!model_snapshot_valid(&snap)) return 0;
+    model_restore(&env->states[index], &snap);
+    env->pending_reset[index] = env->states[index].game_over != 0;
+    return 1;
+}
+
+INV_API int inv_clone(InvEnv* env, int src, int dst) {
+    if (!valid_index(env, src) || !valid_index(env, dst)) return 0;
+    env->states[dst] = env->states[src];
+    env->pending_reset[dst] = env->pending_reset[src];
+    return 1;
+}
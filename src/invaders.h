@@ -0,0 +1,107 @@
+/**
+ * @file invaders.h
+ * @brief API C stable de libinvaders.so : simulation par lots pour d'autres langages (ctypes, cffi, C++...).
+ * @details En-tête autonome (aucune dépendance SDL). Le handle InvEnv est opaque ; toutes les entrées et
+ *          sorties passent par des buffers fournis par l'appelant. Après inv_create() (et la configuration
+ *          éventuelle des pixels), inv_step() et les fonctions d'observation n'allouent jamais de mémoire.
+ *          Les fonctions renvoient 1 en cas de succès, 0 en cas d'erreur (handle ou paramètre invalide).
+ *          La bibliothèque ne lit pas le bundle (pas de SDL) : sans inv_load_tables, elle joue les règles
+ *          intégrées (formation d'origine de 30 ennemis à chaque niveau, programme de comportement intégré).
+ *          Pour jouer le même jeu que ./jeu, lui passer les entrées "waves.bin" et "behaviors.bin" du bundle.
+ */
+
+#ifndef INVADERS_H
+#define INVADERS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(_WIN32)
+    #define INV_API __declspec(dllexport)
+#else
+    #define INV_API __attribute__((visibility("default")))
+#endif
+
+// 2 : état au format ModelSnapshot, tirage aléatoire propre à chaque partie
+// 3 : Enemy de 32 octets (type, mémoire du comportement) et MAX_ENEMIES à 128 (blob d'état plus grand)
+// 4 : tables du jeu chargeables (inv_load_tables, inv_table_hashes), 128 ennemis observés avec leur type
+#define INV_ABI_VERSION 4
+
+typedef struct InvEnv InvEnv;
+
+typedef enum {
+    INV_ACTION_NONE,
+    INV_ACTION_LEFT,
+    INV_ACTION_RIGHT,
+    INV_ACTION_SHOOT,
+    INV_ACTION_LEFT_SHOOT,
+    INV_ACTION_RIGHT_SHOOT,
+    INV_ACTION_COUNT
+} InvAction;
+
+// Vecteur de caractéristiques par partie (floats, unités du jeu) :
+// joueur x, y, vies, niveau, score, direction de la formation, UFO actif, x, y,
+// puis les INV_FEATURE_ENEMIES ennemis (vivant, type, x, y), 10 tirs (actif, x, y), 10 tirs ennemis (actif, x, y),
+// 4 boucliers (santé). Toutes les formations tiennent dans INV_FEATURE_ENEMIES (table des niveaux comprise).
+#define INV_FEATURE_ENEMIES 128
+#define INV_FEATURE_SIZE (9 + INV_FEATURE_ENEMIES * 4 + 10 * 3 + 10 * 3 + 4)
+
+INV_API int inv_abi_version(void);
+
+/**
+ * @brief Installe la table des niveaux et les comportements des ennemis (fichiers waves.bin et behaviors.bin
+ *        du bundle, copiés par la bibliothèque) ; NULL rétablit la table ou le programme intégré.
+ * @details Réglage global de la bibliothèque (toutes les parties, tous les handles) : à faire avant inv_create
+ *          ou suivi de inv_reset. Renvoie 0 si l'une des tables est invalide, rien n'est alors changé.
+ */
+INV_API int inv_load_tables(const void* waves, size_t waves_size, const void* behaviors, size_t behaviors_size);
+
+// Empreintes des tables installées (0 : intégrées), les mêmes que dans les en-têtes des fichiers et les replays :
+// l'appelant les compare à celles du bundle du jeu, en plus de inv_abi_version()
+INV_API int inv_table_hashes(uint64_t* waves_hash, uint64_t* behaviors_hash);
+
+// Crée num_envs parties prêtes à jouer, NULL en cas d'échec
+INV_API InvEnv* inv_create(int num_envs);
+INV_API void inv_destroy(InvEnv* env);
+INV_API int inv_num_envs(const InvEnv* env);
+
+// Graine des parties (la partie i reçoit seed + i) puis réinitialisation de toutes les parties
+INV_API int inv_seed(InvEnv* env, uint64_t seed);
+
+// Réinitialise la partie index, ou toutes si index < 0
+INV_API int inv_reset(InvEnv* env, int index);
+
+/**
+ * @brief Avance toutes les parties de num_steps ticks.
+ * @param actions num_steps * num_envs actions (InvAction), rangées step par step.
+ * @param rewards Sortie optionnelle, même disposition : écart de score du tick.
+ * @param dones Sortie optionnelle, même disposition : 1 si la partie s'est terminée à ce tick.
+ * @details Une partie terminée est réinitialisée au tick suivant, son état final reste donc observable.
+ */
+INV_API int inv_step(InvEnv* env, const int32_t* actions, int num_steps, float* rewards, uint8_t* dones);
+
+// Observations : num_envs * INV_FEATURE_SIZE floats
+INV_API int inv_observe_features(const InvEnv* env, float* out);
+
+// Active les observations pixels (channels 1 : gris, 3 : RGB). Alloue : à appeler hors de la boucle de step.
+INV_API int inv_set_pixel_observation(InvEnv* env, int width, int height, int channels);
+// num_envs * height * width * channels octets
+INV_API int inv_observe_pixels(const InvEnv* env, uint8_t* out);
+
+// État d'une partie (simulation + générateur aléatoire) sous forme de blob opaque de inv_state_size() octets,
+// valable pour la même version d'ABI. inv_load_state lit exactement inv_state_size() octets et renvoie 0,
+// partie inchangée, si le blob ne décrit pas un état jouable (nombre d'ennemis, vitesse, générateur...)
+INV_API size_t inv_state_size(void);
+INV_API int inv_save_state(const InvEnv* env, int index, void* out);
+INV_API int inv_load_state(InvEnv* env, int index, const void* in);
+INV_API int inv_clone(InvEnv* env, int src, int dst);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
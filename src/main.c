@@ -1,13 +1,48 @@
 /**
  * @file main.c
  * @brief Point d'entrée du jeu Space Invaders.
- * @details Gère les arguments de la ligne de commande (-n, -s) et lance le contrôleur.
+ * @details Gère les arguments de la ligne de commande (-n, -s, --timings, --trace, --render-bench, --env, --bot, --record, --replay, --highscores, --flight-recorder, --study, --sweep) et lance le contrôleur.
  * @date 2026
  */
 
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <time.h>
 #include "controller.h"
 #include "model.h"
+#include "timings.h"
+#include "profiler.h"
+#include "render_bench.h"
+#include "shm_env.h"
+#include "bot.h"
+#include "replay.h"
+#include "highscore.h"
+#include "study.h"
+#include "bundle.h"
+#include "waves.h"
+#include "behavior.h"
+#include "wave_cache.h"
+
+/**
+ * @brief Affiche les k meilleurs scores du tableau (saves/highscores.bin).
+ */
+static int print_high_scores(int k) {
+    HighScoreTable* table = highscore_open(HIGHSCORE_PATH);
+    if (!table) { printf("Tableau des scores introuvable : %s\n", HIGHSCORE_PATH); return 0; }
+    HighScore* top = malloc(k * sizeof(HighScore));
+    long n = top ? highscore_top(table, top, k) : 0;
+    printf("--- Meilleurs scores (%ld parties) ---\n", highscore_count(table));
+    for (long i = 0; i < n; i++) {
+        char date[32];
+        time_t t = (time_t)top[i].time;
+        strftime(date, sizeof(date), "%Y-%m-%d %H:%M", localtime(&t));
+        printf("%4ld. %7d  niveau %2d  %-16s %s\n", i + 1, top[i].score, top[i].level, top[i].name, date);
+    }
+    free(top);
+    highscore_close(table);
+    return 1;
+}
 
 /**
  * @brief Fonction principale.
@@ -19,18 +54,135 @@ int main(int argc, char* argv[]) {
     // État par défaut : on lance le Menu Launcher
     ViewMode mode = VIEW_MODE_MENU; 
     GameState state = {0};
+    const char* trace_path = NULL;
+    int render_bench_frames = 0;
+    const char* dump_dir = NULL;
+    const char* env_name = NULL;
+    int env_count = 64, env_pixels = 0;
+    int use_bot = 0, bot_threads = 1, tournament_games = 0;
+    float bot_budget_ms = 8.0f;
+    const char* record_path = NULL;
+    const char* replay_path = NULL;
+    int highscores_shown = 0;
+    long study_games = 0;
+    const char* study_out = NULL;
+    long sweep_games = 0;
+    const char* sweep_rules[64];
+    int sweep_rule_count = 0, sweep_samples = 0;
+    uint64_t seed = 1;
+    int threads_set = 0;
+    uint64_t procedural_seed = 0;
 
     // Analyse des arguments pour forcer un mode spécifique
-    if (argc > 1) {
-        if (strcmp(argv[1], "-n") == 0) {
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-n") == 0) {
             mode = VIEW_MODE_NCURSES; // Force le mode Texte
-        } else if (strcmp(argv[1], "-s") == 0) {
+        } else if (strcmp(argv[i], "-s") == 0) {
             mode = VIEW_MODE_SDL;     // Force le mode Graphique
+        } else if (strcmp(argv[i], "--timings") == 0) {
+            timings_enable(1);        // Affiche les temps de démarrage en sortie
+        } else if (strcmp(argv[i], "--trace") == 0 && i + 1 < argc) {
+            trace_path = argv[++i];   // Export Chrome Trace / Perfetto en fin de partie
+        } else if (strcmp(argv[i], "--render-bench") == 0) {
+            render_bench_frames = (i + 1 < argc && argv[i + 1][0] != '-') ? atoi(argv[++i]) : 1000; // Rendu headless, sans fenêtre
+        } else if (strcmp(argv[i], "--dump-ppm") == 0 && i + 1 < argc) {
+            dump_dir = argv[++i];     // Images du benchmark de rendu exportées en PPM
+        } else if (strcmp(argv[i], "--env") == 0 && i + 1 < argc) {
+            env_name = argv[++i];     // Environnement en mémoire partagée pour agents externes
+        } else if (strcmp(argv[i], "--envs") == 0 && i + 1 < argc) {
+            env_count = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--pixels") == 0 && i + 1 < argc) {
+            env_pixels = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--bot") == 0 && i + 1 < argc) {
+            use_bot = strcmp(argv[++i], "mcts") == 0; // Seul algorithme disponible
+            if (!use_bot) printf("Bot inconnu : %s (disponible : mcts)\n", argv[i]);
+        } else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            bot_threads = atoi(argv[++i]);
+            threads_set = 1;
+        } else if (strcmp(argv[i], "--bot-budget") == 0 && i + 1 < argc) {
+            bot_budget_ms = (float)atof(argv[++i]); // Millisecondes de recherche par tick
+        } else if (strcmp(argv[i], "--tournament") == 0 && i + 1 < argc) {
+            tournament_games = atoi(argv[++i]);     // Parties headless jouées par le bot
+        } else if (strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+            record_path = argv[++i];   // Fichier replay (partie) ou dossier (tournoi)
+        } else if (strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+            replay_path = argv[++i];   // Relecture d'un replay à la place du joueur
+        } else if (strcmp(argv[i], "--highscores") == 0) {
+            highscores_shown = (i + 1 < argc && argv[i + 1][0] != '-') ? atoi(argv[++i]) : 10; // Affiche le tableau et quitte
+        } else if (strcmp(argv[i], "--flight-recorder") == 0 && i + 1 < argc) {
+            controller_set_flight_recorder(argv[++i]); // Reprise d'un enregistrement de plantage
+        } else if (strcmp(argv[i], "--study") == 0 && i + 1 < argc) {
+            study_games = atol(argv[++i]);  // Étude headless : distributions sur N parties scriptées
+        } else if (strcmp(argv[i], "--study-out") == 0 && i + 1 < argc) {
+            study_out = argv[++i];          // Rapport JSON (ou CSV si .csv) ; CSV du balayage
+        } else if (strcmp(argv[i], "--sweep") == 0 && i + 1 < argc) {
+            sweep_games = atol(argv[++i]);  // Balayage de règles : N parties par configuration
+        } else if (strcmp(argv[i], "--rule") == 0 && i + 1 < argc) {
+            if (sweep_rule_count < 64) sweep_rules[sweep_rule_count++] = argv[++i]; // nom=v1,v2,... ou nom=début:fin:pas
+            else i++;
+        } else if (strcmp(argv[i], "--sample") == 0 && i + 1 < argc) {
+            sweep_samples = atoi(argv[++i]); // Configurations tirées au hasard au lieu de la grille
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = strtoull(argv[++i], NULL, 10); // Première graine (tournoi, étude)
+        } else if (strcmp(argv[i], "--procedural") == 0) {
+            // Niveaux procéduraux sans fin ; graine facultative (sinon tirée de l'horloge)
+            procedural_seed = (i + 1 < argc && argv[i + 1][0] != '-') ? strtoull(argv[++i], NULL, 10) : (uint64_t)time(NULL);
+            if (procedural_seed == 0) procedural_seed = 1; // 0 désigne la table des niveaux
         }
     }
 
-    // Lancement de la boucle principale du jeu
-    controller_run(&state, mode);
+    if (trace_path) {
+        if (profiler_available()) profiler_enable(1);
+        else printf("--trace ignoré : profilage désactivé à la compilation (make PROFILE=1)\n");
+    }
+
+    // Table des niveaux compilée (bundle) ; sinon la formation d'origine à tous les niveaux
+    size_t waves_size = 0;
+    const void* waves = bundle_get(WAVES_FILE, &waves_size);
+    if (waves && !waves_set(waves, waves_size)) printf(" Warning: table des niveaux invalide, formation d'origine utilisée\n");
+    size_t behaviors_size = 0;
+    const void* behaviors = bundle_get(BEHAVIOR_FILE, &behaviors_size);
+    if (behaviors && !behavior_set(behaviors, behaviors_size)) printf(" Warning: comportements des ennemis invalides, formation d'origine utilisée\n");
+
+    int status = 0;
+    if (highscores_shown > 0) {
+        status = print_high_scores(highscores_shown) ? 0 : 1;
+    } else if (sweep_games > 0) {
+        status = study_sweep(sweep_games, threads_set ? bot_threads : SDL_GetNumLogicalCPUCores(), seed, sweep_rules,
+                             sweep_rule_count, sweep_samples, study_out ? study_out : "sweep.csv") ? 0 : 1;
+    } else if (study_games > 0) {
+        status = study_run(study_games, threads_set ? bot_threads : SDL_GetNumLogicalCPUCores(), seed,
+                           study_out ? study_out : "study.json") ? 0 : 1;
+    } else if (tournament_games > 0) {
+        status = bot_tournament(tournament_games, bot_threads, bot_budget_ms, seed, record_path) ? 0 : 1;
+    } else if (env_name) {
+        status = shm_env_serve(env_name, env_count, env_pixels) ? 0 : 1;
+    } else if (render_bench_frames > 0) {
+        status = render_bench_run(render_bench_frames, dump_dir) ? 0 : 1;
+    } else {
+        Replay* replay = replay_path ? replay_open(replay_path) : NULL;
+        if (replay_path && !replay) { printf("Replay illisible : %s\n", replay_path); return 1; }
+        if (replay && replay_header(replay)->waves_hash != waves_hash()) printf(" Warning: replay enregistré avec une autre table des niveaux, la relecture va diverger\n");
+        if (replay && replay_header(replay)->behaviors_hash != behavior_hash()) printf(" Warning: replay enregistré avec d'autres comportements d'ennemis, la relecture va diverger\n");
+        Bot* bot = use_bot ? bot_create(bot_threads, bot_budget_ms) : NULL;
+        controller_set_bot(bot);
+        controller_set_replay(replay);
+        if (record_path) controller_set_record(record_path);
+        model_default_rules(&state.rules);
+        state.rules.wave_seed = procedural_seed;
+        uint64_t cache_seed = procedural_seed ? procedural_seed : (replay ? replay_header(replay)->waves_seed : 0);
+        if (cache_seed) wave_cache_start(cache_seed);
+        // Lancement de la boucle principale du jeu
+        controller_run(&state, mode);
+        timings_report();
+        wave_cache_stop();
+        replay_close(replay);
+    }
+
+    if (trace_path && profiler_available()) {
+        if (profiler_write_trace(trace_path)) printf("Trace écrite dans %s\n", trace_path);
+        else printf("Impossible d'écrire la trace %s\n", trace_path);
+    }
 
-    return 0;
+    return status;
 }
\ No newline at end of file
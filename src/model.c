@@ -7,13 +7,24 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <math.h>
+#include <string.h>
+#include <stddef.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include "model.h"
+#include "profiler.h"
+#include "waves.h"
+#include "behavior.h"
+#include "sprites.h"
+#include "invaders.h"
 
-// Vitesses de base
-#define ENEMY_SPEED 2
-#define PROJECTILE_SPEED 7
+#define MODEL_DEFAULT_SEED 0x5EED5EEDu
+
+_Static_assert(offsetof(ModelSnapshot, shots) == offsetof(GameState, shots)
+               && offsetof(ModelSnapshot, enemies) == offsetof(GameState, enemies)
+               && offsetof(ModelSnapshot, ufo) == offsetof(GameState, ufo)
+               && offsetof(ModelSnapshot, rng) == offsetof(GameState, rng),
+               "ModelSnapshot doit reprendre l'ordre des champs simulés de GameState");
 
 /**
  * @brief Vérifie la collision AABB (Axis-Aligned Bounding Box) entre deux rectangles.
@@ -22,17 +33,144 @@ int check_collision(float x1, float y1, int w1, int h1, float x2, float y2, int
     return (x1 < x2 + w2 && x1 + w1 > x2 && y1 < y2 + h2 && y1 + h1 > y2);
 }
 
+// Échelle des sprites (même facteur que le rendu) : les collisions des tirs se font au pixel près
+#define PLAYER_SCALE ((float)PLAYER_W / SPRITE_PLAYER_W)
+#define ENEMY_SCALE ((float)ENEMY_W / SPRITE_ENEMY_W)
+#define UFO_SCALE ((float)UFO_W / SPRITE_UFO_W)
+#define SHIELD_SCALE ((float)SHIELD_W / SPRITE_SHIELD_W)
+
+// Boîtes englobantes d'abord (test en ligne) : le masque du sprite n'est consulté qu'en cas de recouvrement
+static int shot_box(const Shot* shot, float x, float y, int w, int h) {
+    return check_collision(shot->pos.x, shot->pos.y, SHOT_W, SHOT_H, x, y, w, h);
+}
+
+static int shot_mask(const Shot* shot, SpriteId sprite, float x, float y, float scale) {
+    return sprite_hit_rect(sprite, x, y, scale, shot->pos.x, shot->pos.y, SHOT_W, SHOT_H);
+}
+
+// Les deux images de l'animation comptent : le modèle ne sait pas laquelle est affichée
+static int shot_hits_enemy(const Shot* shot, const Enemy* enemy) {
+    return shot_box(shot, enemy->pos.x, enemy->pos.y, ENEMY_W, ENEMY_H)
+        && (shot_mask(shot, SPRITE_ENEMY_1, enemy->pos.x, enemy->pos.y, ENEMY_SCALE)
+            || shot_mask(shot, SPRITE_ENEMY_2, enemy->pos.x, enemy->pos.y, ENEMY_SCALE));
+}
+
+static int shot_hits_shield(const Shot* shot, const Shield* shield) {
+    return shot_box(shot, shield->pos.x, shield->pos.y, SHIELD_W, SHIELD_H)
+        && shot_mask(shot, sprite_shield_for_health(shield->health), shield->pos.x, shield->pos.y, SHIELD_SCALE);
+}
+
+/**
+ * @brief Ajoute un événement au tampon du tick courant (ignoré si le tampon est plein).
+ */
+static void model_emit(GameState* state, GameEventType type, float x, float y) {
+    if (state->event_count >= MAX_EVENTS) return;
+    GameEvent* ev = &state->events[state->event_count++];
+    ev->type = type;
+    ev->x = x;
+    ev->y = y;
+}
+
+void model_clear_events(GameState* state) {
+    state->event_count = 0;
+}
+
+/**
+ * @brief Empreinte des champs simulés, octets de bourrage exclus (entre l'UFO et le générateur).
+ */
+uint64_t model_hash(const GameState* state) {
+    uint64_t h = fnv1a(FNV1A_OFFSET, state, offsetof(GameState, ufo) + sizeof(Ufo));
+    h = fnv1a(h, &state->rng, sizeof(state->rng));
+    return fnv1a(h, &state->settings.player_speed, sizeof(int));
+}
+
+void model_count_entities(const GameState* state, EntityCounts* counts) {
+    memset(counts, 0, sizeof(*counts));
+    for (int i = 0; i < state->enemy_count; i++) counts->enemies += state->enemies[i].alive;
+    for (int i = 0; i < MAX_SHOTS; i++) counts->shots += state->shots[i].active;
+    for (int i = 0; i < MAX_ENEMY_SHOTS; i++) counts->enemy_shots += state->enemy_shots[i].active;
+    for (int i = 0; i < MAX_EXPLOSIONS; i++) counts->explosions += state->explosions[i].active;
+    for (int i = 0; i < MAX_SHIELDS; i++) counts->shields += (state->shields[i].active && state->shields[i].health > 0);
+    counts->ufo = state->ufo.active;
+}
+
+/**
+ * @brief Initialise le générateur de la partie (splitmix64 de la graine, l'état de xorshift ne doit pas être nul).
+ */
+void model_seed(GameState* state, uint64_t seed) {
+    uint64_t z = seed + 0x9E3779B97F4A7C15ull;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    z ^= z >> 31;
+    state->rng = z ? z : MODEL_DEFAULT_SEED;
+}
+
+/**
+ * @brief Tirage xorshift64* : l'aléa de la simulation ne dépend que de l'état, jamais de rand().
+ */
+uint32_t model_random(GameState* state) {
+    uint64_t x = state->rng;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    state->rng = x;
+    return (uint32_t)((x * 0x2545F4914F6CDD1Dull) >> 32);
+}
+
+// Taille de la partie simulée de GameState, identique au début de ModelSnapshot
+#define MODEL_SIM_BYTES (offsetof(GameState, rng) + sizeof(uint64_t))
+
+void model_snapshot(const GameState* state, ModelSnapshot* snap) {
+    memcpy(snap, state, MODEL_SIM_BYTES);
+    snap->player_speed = state->settings.player_speed;
+}
+
+/**
+ * @brief Recharge un instantané ; les préférences (touches, volume) de l'état cible sont conservées.
+ */
+void model_restore(GameState* state, const ModelSnapshot* snap) {
+    memcpy(state, snap, MODEL_SIM_BYTES);
+    state->settings.player_speed = snap->player_speed;
+    state->event_count = 0;
+}
+
+/**
+ * @brief Contrôle un instantané venu d'un fichier (replay, enregistreur de vol, sauvegarde) avant model_restore.
+ * @details model_update parcourt enemies[enemy_count] et range les ennemis dans un tableau de MAX_ENEMIES :
+ *          un effectif hors bornes y déborde. Plusieurs tirs peuvent toucher le joueur dans le même tick,
+ *          d'où des vies légèrement négatives en fin de partie. Les positions doivent être finies (collisions).
+ */
+int model_snapshot_valid(const ModelSnapshot* snap) {
+    if (snap->enemy_count < 0 || snap->enemy_count > MAX_ENEMIES || snap->rng == 0
+        || snap->player_speed < PLAYER_SPEED_MIN || snap->player_speed > PLAYER_SPEED_MAX
+        || snap->lives < -MAX_ENEMY_SHOTS || snap->lives > PLAYER_LIVES || snap->level < 1
+        || snap->game_over < 0 || snap->game_over > 2 || !isfinite(snap->pos.x) || !isfinite(snap->pos.y)) return 0;
+    for (int i = 0; i < snap->enemy_count; i++) {
+        if (!isfinite(snap->enemies[i].pos.x) || !isfinite(snap->enemies[i].pos.y)) return 0;
+    }
+    return 1;
+}
+
+void model_default_rules(GameRules* rules) {
+    rules->enemy_speed = 2;
+    rules->projectile_speed = 7;
+    rules->enemy_shot_chance = 2;
+    rules->ufo_chance = 2;
+    rules->formation_drop = 20;
+    rules->wave_seed = 0;
+}
+
 /**
- * @brief Initialise ou réinitialise une partie.
- * @param state Pointeur vers l'état du jeu.
+ * @brief Remet à zéro la partie (score, vies, joueur, tirs, boucliers) sans toucher aux règles ni à la vague.
  */
-void model_init(GameState* state) {
+static void model_init(GameState* state) {
     state->score = 0; 
-    state->lives = 3; 
+    state->lives = PLAYER_LIVES; 
     state->level = 1; 
     state->game_over = 0;
     state->pos.x = GAME_WIDTH / 2; 
     state->pos.y = GAME_HEIGHT - 60; 
+    if (state->rng == 0) model_seed(state, MODEL_DEFAULT_SEED); // Le tirage continue d'une partie à l'autre
     
     // Initialisation des paramètres par défaut (uniquement au premier lancement)
     if (state->settings.player_speed == 0) {
@@ -58,6 +196,22 @@ void model_init(GameState* state) {
     
     for(int i=0; i<MAX_EXPLOSIONS; i++) state->explosions[i].active = 0;
     state->ufo.active = 0; state->ufo.timer = 0;
+    state->event_count = 0;
+}
+
+/**
+ * @brief Place la formation du niveau courant (table des niveaux ou générateur) et efface les tirs ennemis en vol.
+ */
+void spawn_wave(GameState* s) {
+    if (s->rules.wave_seed) {
+        s->enemy_count = waves_spawn_generated(s->rules.wave_seed, s->level, s->enemies);
+    } else {
+        const WaveLevel* wave = waves_level(s->level);
+        s->enemy_count = wave->enemy_count;
+        memcpy(s->enemies, waves_enemies(wave), wave->enemy_count * sizeof(Enemy));
+    }
+    s->enemy_direction = 1;
+    for (int i = 0; i < MAX_ENEMY_SHOTS; i++) s->enemy_shots[i].active = 0;
 }
 
 void model_move_left(GameState* state) { 
@@ -76,11 +230,61 @@ void model_shoot(GameState* state) {
             state->shots[i].active = 1; 
             state->shots[i].pos.x = state->pos.x + (PLAYER_W / 2); 
             state->shots[i].pos.y = state->pos.y; 
+            model_emit(state, EVENT_SHOT_FIRED, state->shots[i].pos.x, state->shots[i].pos.y);
             break; 
         }
     }
 }
 
+/**
+ * @brief Un tick complet des règles : model_update puis vague suivante si la formation est détruite.
+ * @details Point d'entrée commun du contrôleur, de l'environnement partagé et de libinvaders.
+ */
+void model_tick(GameState* state) {
+    model_update(state);
+    for (int i = 0; i < state->enemy_count; i++) if (state->enemies[i].alive) return;
+    state->level++;
+    spawn_wave(state);
+}
+
+/**
+ * @brief Nouvelle partie : règles de la partie, remise à zéro puis première vague.
+ * @param state Pointeur vers l'état du jeu (générateur et préférences conservés).
+ * @param rules Règles de la partie (peut être &state->rules pour les garder), NULL pour model_default_rules.
+ * @details Seul point d'entrée d'une partie : les règles sont en place avant la première vague
+ *          (niveaux procéduraux de GameRules.wave_seed).
+ */
+void model_new_game(GameState* state, const GameRules* rules) {
+    if (rules) state->rules = *rules;
+    else model_default_rules(&state->rules);
+    model_init(state);
+    spawn_wave(state);
+}
+
+/**
+ * @brief Repart d'un état vierge en gardant le générateur : les épisodes d'une même partie ne se répètent pas.
+ * @details Réinitialisation des environnements d'entraînement (mémoire partagée et libinvaders).
+ */
+void model_reset_game(GameState* state) {
+    uint64_t rng = state->rng;
+    memset(state, 0, sizeof(*state));
+    state->rng = rng;
+    model_new_game(state, NULL);
+}
+
+/**
+ * @brief Applique une action d'agent (codes InvAction de invaders.h, communs aux deux environnements) et avance d'un tick.
+ */
+float model_step_action(GameState* state, int action) {
+    int previous_score = state->score;
+    if (action == INV_ACTION_LEFT || action == INV_ACTION_LEFT_SHOOT) model_move_left(state);
+    if (action == INV_ACTION_RIGHT || action == INV_ACTION_RIGHT_SHOOT) model_move_right(state);
+    if (action == INV_ACTION_SHOOT || action == INV_ACTION_LEFT_SHOOT || action == INV_ACTION_RIGHT_SHOOT) model_shoot(state);
+    model_tick(state);
+    model_clear_events(state);
+    return (float)(state->score - previous_score);
+}
+
 /**
  * @brief Met à jour la logique du jeu (Appelé à chaque frame).
  * @details Gère les tirs, les mouvements ennemis et toutes les collisions.
@@ -89,32 +293,40 @@ void model_update(GameState* state) {
     if (state->game_over) return;
     
     // --- 1. Mise à jour des tirs Joueur ---
+    PROFILE_BEGIN(prof_shots, "tirs joueur");
     for (int i = 0; i < MAX_SHOTS; i++) { 
         if (state->shots[i].active) { 
-            state->shots[i].pos.y -= PROJECTILE_SPEED; 
+            state->shots[i].pos.y -= state->rules.projectile_speed; 
             if (state->shots[i].pos.y < 0) state->shots[i].active = 0; 
         } 
     }
+    PROFILE_END(prof_shots);
     
     // --- 2. Mise à jour des tirs Ennemis ---
+    PROFILE_BEGIN(prof_enemy_shots, "tirs ennemis");
     for (int i = 0; i < MAX_ENEMY_SHOTS; i++) {
         if (state->enemy_shots[i].active) {
-            state->enemy_shots[i].pos.y += PROJECTILE_SPEED;
+            state->enemy_shots[i].pos.y += state->rules.projectile_speed;
             
             // Sortie d'écran
             if (state->enemy_shots[i].pos.y > GAME_HEIGHT) state->enemy_shots[i].active = 0;
             
             // Collision avec Joueur
-            if (check_collision(state->enemy_shots[i].pos.x, state->enemy_shots[i].pos.y, 4, 10, state->pos.x, state->pos.y, PLAYER_W, PLAYER_H)) {
+            if (shot_box(&state->enemy_shots[i], state->pos.x, state->pos.y, PLAYER_W, PLAYER_H)
+                && shot_mask(&state->enemy_shots[i], SPRITE_PLAYER, state->pos.x, state->pos.y, PLAYER_SCALE)) {
                 state->enemy_shots[i].active = 0; 
                 state->lives--; 
-                if(state->lives <= 0) state->game_over = 1;
+                model_emit(state, EVENT_PLAYER_HIT, state->pos.x, state->pos.y);
+                if(state->lives <= 0 && !state->game_over) {
+                    state->game_over = 1;
+                    model_emit(state, EVENT_GAME_OVER, state->pos.x, state->pos.y);
+                }
             }
             
             // Collision avec Boucliers
             for(int k=0; k<MAX_SHIELDS; k++) {
                 if(state->shields[k].active && state->shields[k].health > 0) {
-                    if(check_collision(state->enemy_shots[i].pos.x, state->enemy_shots[i].pos.y, 4, 10, state->shields[k].pos.x, state->shields[k].pos.y, SHIELD_W, SHIELD_H)) {
+                    if(shot_hits_shield(&state->enemy_shots[i], &state->shields[k])) {
                         state->enemy_shots[i].active = 0; 
                         state->shields[k].health--;
                     }
@@ -122,56 +334,59 @@ void model_update(GameState* state) {
             }
         }
     }
+    PROFILE_END(prof_enemy_shots);
     
     // --- 3. Déplacement des Ennemis ---
+    PROFILE_BEGIN(prof_formation, "formation");
     int hit_edge = 0; 
     int lowest_enemy_y = 0;
+    float speed_scale, fire_scale;
+    if (state->rules.wave_seed) waves_generated_scales(state->level, &speed_scale, &fire_scale);
+    else { const WaveLevel* wave = waves_level(state->level); speed_scale = wave->speed_scale; fire_scale = wave->fire_scale; }
+    float enemy_speed = state->rules.enemy_speed * speed_scale;
+    uint32_t shot_chance[WAVES_MAX_TYPES]; // Seuils de tir par type d'ennemi pour ce niveau
+    for (int t = 0; t < WAVES_MAX_TYPES; t++) shot_chance[t] = (uint32_t)(state->rules.enemy_shot_chance * fire_scale * waves_type(t)->fire_scale);
     
+    // Déplacement et tirs : programme de chaque type (par défaut, le pas de la formation et un tir aléatoire)
+    int order[MAX_ENEMIES];
+    BehaviorContext behavior = { state, enemy_speed * state->enemy_direction, shot_chance };
+    behavior_run_all(&behavior, state->enemies, state->enemy_count, order);
+
     for (int i = 0; i < state->enemy_count; i++) {
         if (state->enemies[i].alive) {
-            state->enemies[i].pos.x += (ENEMY_SPEED * state->enemy_direction);
-            
-            // Détection des bords
-            if (state->enemies[i].pos.x <= 0 || state->enemies[i].pos.x >= GAME_WIDTH - ENEMY_W) hit_edge = 1;
+            // Détection du bord vers lequel avance la formation (un ennemi qui oscille ne la fait pas rebrousser deux fois)
+            if (state->enemy_direction > 0 ? state->enemies[i].pos.x >= GAME_WIDTH - ENEMY_W : state->enemies[i].pos.x <= 0) hit_edge = 1;
             if (state->enemies[i].pos.y > lowest_enemy_y) lowest_enemy_y = state->enemies[i].pos.y;
-            
-            // Probabilité de tir ennemi
-            if ((rand() % 2000) < 2) { 
-                for(int k=0; k<MAX_ENEMY_SHOTS; k++) {
-                    if(!state->enemy_shots[k].active) {
-                        state->enemy_shots[k].active = 1; 
-                        state->enemy_shots[k].pos.x = state->enemies[i].pos.x + ENEMY_W/2; 
-                        state->enemy_shots[k].pos.y = state->enemies[i].pos.y + ENEMY_H; 
-                        break;
-                    }
-                }
-            }
         }
     }
     
     // Descente des ennemis si bord touché
     if (hit_edge) { 
         state->enemy_direction *= -1; 
-        for (int i = 0; i < state->enemy_count; i++) state->enemies[i].pos.y += 20; 
+        for (int i = 0; i < state->enemy_count; i++) state->enemies[i].pos.y += state->rules.formation_drop; 
     }
     
     // Game Over si les ennemis touchent le bas
     if (lowest_enemy_y > state->pos.y - 50) { 
         state->lives = 0; 
+        if (!state->game_over) model_emit(state, EVENT_GAME_OVER, state->pos.x, state->pos.y);
         state->game_over = 1; 
     }
+    PROFILE_END(prof_formation);
     
     // --- 4. Collisions Tirs Joueur vs Ennemis/UFO/Boucliers ---
+    PROFILE_BEGIN(prof_collisions, "collisions");
     for (int i = 0; i < MAX_SHOTS; i++) {
         if (!state->shots[i].active) continue;
         
         // Contre Ennemis
         for (int j = 0; j < state->enemy_count; j++) {
             if (state->enemies[j].alive) {
-                if (check_collision(state->shots[i].pos.x, state->shots[i].pos.y, 4, 10, state->enemies[j].pos.x, state->enemies[j].pos.y, ENEMY_W, ENEMY_H)) {
+                if (shot_hits_enemy(&state->shots[i], &state->enemies[j])) {
                     state->enemies[j].alive = 0; 
                     state->shots[i].active = 0; 
-                    state->score += 10;
+                    state->score += waves_type(state->enemies[j].type)->points;
+                    model_emit(state, EVENT_ENEMY_KILLED, state->enemies[j].pos.x, state->enemies[j].pos.y);
                     
                     // Spawn explosion
                     for(int k=0; k<MAX_EXPLOSIONS; k++) { 
@@ -191,10 +406,12 @@ void model_update(GameState* state) {
         
         // Contre UFO
         if(state->shots[i].active && state->ufo.active) {
-            if(check_collision(state->shots[i].pos.x, state->shots[i].pos.y, 4, 10, state->ufo.x, state->ufo.y, UFO_W, UFO_H)) { 
+            if(shot_box(&state->shots[i], state->ufo.x, state->ufo.y, UFO_W, UFO_H)
+                && shot_mask(&state->shots[i], SPRITE_UFO, state->ufo.x, state->ufo.y, UFO_SCALE)) { 
                 state->ufo.active = 0; 
                 state->shots[i].active = 0; 
                 state->score += 100; 
+                model_emit(state, EVENT_UFO_KILLED, state->ufo.x, state->ufo.y);
             }
         }
         
@@ -202,7 +419,7 @@ void model_update(GameState* state) {
         if(state->shots[i].active) {
             for(int k=0; k<MAX_SHIELDS; k++) {
                 if(state->shields[k].active && state->shields[k].health > 0) {
-                    if(check_collision(state->shots[i].pos.x, state->shots[i].pos.y, 4, 10, state->shields[k].pos.x, state->shields[k].pos.y, SHIELD_W, SHIELD_H)) { 
+                    if(shot_hits_shield(&state->shots[i], &state->shields[k])) { 
                         state->shots[i].active = 0; 
                         state->shields[k].health--; 
                     }
@@ -210,10 +427,12 @@ void model_update(GameState* state) {
             }
         }
     }
+    PROFILE_END(prof_collisions);
     
     // --- 5. Gestion UFO ---
+    PROFILE_BEGIN(prof_ufo, "ufo");
     if (!state->ufo.active) { 
-        if (rand() % 1000 < 2) { 
+        if (model_random(state) % RULES_UFO_RANGE < (uint32_t)state->rules.ufo_chance) { 
             state->ufo.active = 1; 
             state->ufo.x = -UFO_W; 
             state->ufo.y = 40; 
@@ -223,14 +442,17 @@ void model_update(GameState* state) {
         state->ufo.x += 3 * state->ufo.direction; 
         if (state->ufo.x > GAME_WIDTH + 50) state->ufo.active = 0; 
     }
+    PROFILE_END(prof_ufo);
     
     // --- 6. Timer Explosions ---
+    PROFILE_BEGIN(prof_explosions, "explosions");
     for(int i=0; i<MAX_EXPLOSIONS; i++) { 
         if(state->explosions[i].active) { 
             state->explosions[i].timer--; 
             if(state->explosions[i].timer <= 0) state->explosions[i].active = 0; 
         } 
     }
+    PROFILE_END(prof_explosions);
 }
 
 // --- SYSTÈME DE SAUVEGARDE (BINAIRE) ---
@@ -252,34 +474,43 @@ int model_save_slot(const GameState* state, int slot) {
         f = fopen(filename, "wb"); 
         if (!f) return 0; 
     }
-    fwrite(state, sizeof(GameState), 1, f);
-    fclose(f);
-    return 1;
+    SaveHeader h = { SAVE_MAGIC, SAVE_VERSION, sizeof(GameState), 0 };
+    int ok = fwrite(&h, sizeof(h), 1, f) == 1 && fwrite(state, sizeof(GameState), 1, f) == 1;
+    return fclose(f) == 0 && ok;
 }
 
-int model_load_slot(GameState* state, int slot) {
+/**
+ * @brief Lit un slot dans out : 1 si la sauvegarde a la disposition courante et un état jouable.
+ * @details Sans en-tête (versions antérieures) ou avec un autre GameState, les octets ne correspondent
+ *          plus aux champs : la sauvegarde est ignorée plutôt que chargée de travers.
+ */
+static int read_slot(int slot, GameState* out) {
     char filename[64];
     sprintf(filename, "saves/save_%d.bin", slot);
     FILE* f = fopen(filename, "rb");
     if (!f) return 0;
-    fread(state, sizeof(GameState), 1, f);
+    SaveHeader h;
+    int ok = fread(&h, sizeof(h), 1, f) == 1 && h.magic == SAVE_MAGIC && h.version == SAVE_VERSION
+          && h.state_size == sizeof(GameState) && fread(out, sizeof(GameState), 1, f) == 1;
     fclose(f);
+    if (!ok) return 0;
+    ModelSnapshot snap;
+    model_snapshot(out, &snap);
+    return model_snapshot_valid(&snap);
+}
+
+int model_load_slot(GameState* state, int slot) {
+    GameState temp;
+    if (!read_slot(slot, &temp)) return 0;
+    *state = temp;
+    model_clear_events(state);
     return 1;
 }
 
 int model_get_slot_info(int slot, int* score, int* level) {
-    char filename[64];
-    sprintf(filename, "saves/save_%d.bin", slot);
-    FILE* f = fopen(filename, "rb");
-    if (!f) return 0; 
-    
     GameState temp;
-    if (fread(&temp, sizeof(GameState), 1, f) == 1) {
-        *score = temp.score;
-        *level = temp.level;
-        fclose(f);
-        return 1;
-    }
-    fclose(f);
-    return 0;
+    if (!read_slot(slot, &temp)) return 0;
+    *score = temp.score;
+    *level = temp.level;
+    return 1;
 }
\ No newline at end of file
@@ -8,6 +8,7 @@
 #define MODEL_H
 
 #include <stdio.h> 
+#include <stdint.h>
 #include <SDL3/SDL.h> // Nécessaire pour SDL_Keycode
 
 // --- CONSTANTES DU JEU ---
@@ -23,12 +24,16 @@
 #define SHIELD_H 40
 #define UFO_W 40
 #define UFO_H 20
+#define SHOT_W 4
+#define SHOT_H 15
 
 // Limites des tableaux statiques
 #define MAX_SHOTS 10
 #define MAX_ENEMY_SHOTS 10
 #define MAX_EXPLOSIONS 20
 #define MAX_SHIELDS 4
+#define MAX_EVENTS 64
+#define MAX_ENEMIES 128 // Plus grande formation d'un niveau (voir waves.h)
 
 /**
  * @brief Types d'entrées abstraites (indépendantes du clavier/souris).
@@ -44,7 +49,9 @@ typedef enum {
     INPUT_SWITCH_MODE, // Bascule SDL <-> Ncurses
     INPUT_SAVE,
     INPUT_LOAD,
-    INPUT_1, INPUT_2, INPUT_3 // Sélection des slots
+    INPUT_1, INPUT_2, INPUT_3, // Sélection des slots
+    INPUT_DEBUG_HUD, // Affiche/masque l'overlay de performance (F3)
+    INPUT_REWIND // Retour arrière, tant que la touche est maintenue (Retour arrière)
 } InputType;
 
 /**
@@ -58,26 +65,76 @@ typedef enum {
     VIEW_MODE_SDL_LOAD 
 } ViewMode;
 
+/**
+ * @brief Événements de gameplay émis par le modèle (consommés par le contrôleur : sons, stats...).
+ */
+typedef enum {
+    EVENT_SHOT_FIRED,
+    EVENT_ENEMY_KILLED,
+    EVENT_UFO_KILLED,
+    EVENT_PLAYER_HIT,
+    EVENT_GAME_OVER
+} GameEventType;
+
 // --- STRUCTURES ---
 
 typedef struct { float x, y; } Position;
 typedef struct { Position pos; int active; } Shot;
-typedef struct { Position pos; int active; int alive; } Enemy;
+typedef struct {
+    Position pos;
+    int type;           // Indice dans la table des niveaux (points, tir, couleur, comportement)
+    int alive;
+    float reg[4];       // Mémoire du programme de comportement, conservée entre les ticks (voir behavior.h)
+} Enemy;
 typedef struct { int active; int type; int timer; float x, y; } Explosion;
 typedef struct { Position pos; int active; int health; } Shield;
 typedef struct { float x, y; int active; int timer; int direction; } Ufo;
+typedef struct { GameEventType type; float x, y; } GameEvent;
+
+#define PLAYER_SPEED_MIN 1
+#define PLAYER_SPEED_MAX 20
+#define PLAYER_LIVES 3 // Vies en début de partie (jamais regagnées)
 
 /**
  * @brief Paramètres configurables par le joueur.
  */
 typedef struct {
     int volume;         // 0 à 100
-    int player_speed;   // Vitesse de déplacement (1-20)
+    int player_speed;   // Vitesse de déplacement (PLAYER_SPEED_MIN à PLAYER_SPEED_MAX)
     SDL_Keycode key_left;
     SDL_Keycode key_right;
     SDL_Keycode key_shoot;
 } GameSettings;
 
+/**
+ * @brief Règles de gameplay réglables à l'exécution (équilibrage, balayages de paramètres).
+ * @details Les chances sont des tirages sur RULES_SHOT_RANGE ou RULES_UFO_RANGE : avec les valeurs par
+ *          défaut, la simulation est identique à celle des constantes d'origine (mêmes tirages).
+ */
+typedef struct {
+    float enemy_speed;       // Déplacement horizontal de la formation par tick (2)
+    float projectile_speed;  // Déplacement des tirs par tick (7)
+    int enemy_shot_chance;   // Chances de tir par ennemi et par tick, sur RULES_SHOT_RANGE (2)
+    int ufo_chance;          // Chances d'apparition de l'UFO par tick, sur RULES_UFO_RANGE (2)
+    float formation_drop;    // Descente de la formation à chaque bord (20)
+    uint64_t wave_seed;      // 0 : table des niveaux ; sinon graine du générateur procédural (voir waves.h)
+} GameRules;
+
+#define RULES_SHOT_RANGE 2000
+#define RULES_UFO_RANGE 1000
+
+/**
+ * @brief Nombre d'entités vivantes (overlay de performance, statistiques).
+ */
+typedef struct {
+    int enemies;
+    int shots;
+    int enemy_shots;
+    int explosions;
+    int shields;
+    int ufo;
+} EntityCounts;
+
 /**
  * @brief État complet du jeu (Sauvegardable tel quel).
  */
@@ -91,22 +148,75 @@ typedef struct {
     Shot enemy_shots[MAX_ENEMY_SHOTS];
     int enemy_count; 
     int enemy_direction;    // 1: Droite, -1: Gauche
-    Enemy enemies[50];
+    Enemy enemies[MAX_ENEMIES];
     Explosion explosions[MAX_EXPLOSIONS];
     Shield shields[MAX_SHIELDS];
     Ufo ufo;
+    uint64_t rng;           // Générateur pseudo-aléatoire (xorshift64*), jamais nul. Dernier champ simulé : voir ModelSnapshot
+    int event_count;        // Événements émis depuis le dernier model_clear_events()
+    GameEvent events[MAX_EVENTS];
     GameSettings settings;  // Préférences utilisateur
+    GameRules rules;        // Règles de la partie (par défaut sauf étude/balayage)
 } GameState;
 
+/**
+ * @brief Instantané de la simulation (recherche arborescente, rewind, replays).
+ * @details Reprend, dans le même ordre, les champs de GameState jusqu'au générateur inclus : la copie est
+ *          un seul memcpy de taille fixe (4,9 Ko, contre 5,7 Ko pour GameState). Seuls les événements et les
+ *          préférences en sont exclus, hormis la vitesse du joueur ; les MAX_ENEMIES emplacements et les
+ *          explosions sont copiés en entier, comme les hache model_hash et les stockent replays et rewind.
+ */
+typedef struct {
+    Position pos;
+    int score;
+    int lives;
+    int level;
+    int game_over;
+    Shot shots[MAX_SHOTS];
+    Shot enemy_shots[MAX_ENEMY_SHOTS];
+    int enemy_count;
+    int enemy_direction;
+    Enemy enemies[MAX_ENEMIES];
+    Explosion explosions[MAX_EXPLOSIONS];
+    Shield shields[MAX_SHIELDS];
+    Ufo ufo;
+    uint64_t rng;
+    int player_speed;
+} ModelSnapshot;
+
 // --- PROTOTYPES ---
 
-void model_init(GameState* state);
+int check_collision(float x1, float y1, int w1, int h1, float x2, float y2, int w2, int h2);
+void model_new_game(GameState* state, const GameRules* rules); // Règles (NULL : par défaut) puis partie neuve
+void model_default_rules(GameRules* rules);
+void model_seed(GameState* state, uint64_t seed);
+uint32_t model_random(GameState* state);
+void spawn_wave(GameState* s);
 void model_update(GameState* state);
+void model_tick(GameState* state); // model_update + passage au niveau suivant
+void model_reset_game(GameState* state); // Partie neuve (règles et préférences par défaut), générateur conservé
+float model_step_action(GameState* state, int action); // Action d'agent (InvAction) puis un tick ; renvoie l'écart de score
 void model_move_left(GameState* state);
 void model_move_right(GameState* state);
 void model_shoot(GameState* state);
+void model_clear_events(GameState* state);
+void model_count_entities(const GameState* state, EntityCounts* counts);
+void model_snapshot(const GameState* state, ModelSnapshot* snap);
+void model_restore(GameState* state, const ModelSnapshot* snap);
+int model_snapshot_valid(const ModelSnapshot* snap); // 1 si l'instantané peut être simulé sans sortir des tableaux
+uint64_t model_hash(const GameState* state); // Empreinte FNV-1a de l'état simulé (vérification des replays)
+
+// Gestion des sauvegardes : SaveHeader puis le GameState brut (relu uniquement par la même disposition)
+#define SAVE_MAGIC 0x31565349u // "ISV1"
+#define SAVE_VERSION 2         // 2 : en-tête ajouté (GameState avec règles, générateur et ennemis typés)
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t state_size;       // sizeof(GameState) à l'écriture : sauvegarde refusée si différent
+    uint32_t reserved;
+} SaveHeader;
 
-// Gestion des sauvegardes
 void model_init_save_system(); 
 int model_save_slot(const GameState* state, int slot);
 int model_load_slot(GameState* state, int slot);
@@ -0,0 +1,103 @@
+/**
+ * @file profiler.c
+ * @brief Implémentation du profileur : un tampon circulaire par thread, horloge monotone.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <time.h>
+#include "profiler.h"
+
+#define PROFILE_BUFFER_SIZE 65536 // Zones conservées par thread (les plus récentes)
+#define PROFILE_MAX_THREADS 64
+
+typedef struct { const char* name; uint64_t start_ns; uint64_t duration_ns; } ProfileRecord;
+
+typedef struct {
+    int thread_id;
+    uint64_t count; // Total écrit (la position réelle est count % PROFILE_BUFFER_SIZE)
+    ProfileRecord records[PROFILE_BUFFER_SIZE];
+} ProfileBuffer;
+
+static int is_enabled = 0;
+static uint64_t origin_ns = 0;
+static ProfileBuffer* buffers[PROFILE_MAX_THREADS];
+static atomic_int buffer_count = 0;
+static _Thread_local ProfileBuffer* thread_buffer = NULL;
+
+static uint64_t now_ns() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+int profiler_available() {
+#ifdef PROFILING
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+void profiler_enable(int enabled) {
+    is_enabled = enabled;
+    if (enabled && origin_ns == 0) origin_ns = now_ns();
+}
+
+ProfileZone profiler_begin(const char* name) {
+    ProfileZone zone = { name, is_enabled ? now_ns() : 0 };
+    return zone;
+}
+
+/**
+ * @brief Enregistre le tampon du thread courant au premier appel.
+ */
+static ProfileBuffer* get_thread_buffer() {
+    if (thread_buffer) return thread_buffer;
+    int id = atomic_fetch_add(&buffer_count, 1);
+    if (id >= PROFILE_MAX_THREADS) return NULL;
+    ProfileBuffer* b = calloc(1, sizeof(ProfileBuffer));
+    if (!b) return NULL;
+    b->thread_id = id + 1;
+    buffers[id] = b;
+    thread_buffer = b;
+    return b;
+}
+
+void profiler_end(const ProfileZone* zone) {
+    if (!is_enabled || zone->start_ns == 0) return;
+    uint64_t end = now_ns();
+    ProfileBuffer* b = get_thread_buffer();
+    if (!b) return;
+    ProfileRecord* r = &b->records[b->count % PROFILE_BUFFER_SIZE];
+    r->name = zone->name;
+    r->start_ns = zone->start_ns;
+    r->duration_ns = end - zone->start_ns;
+    b->count++;
+}
+
+int profiler_write_trace(const char* path) {
+    FILE* f = fopen(path, "w");
+    if (!f) return 0;
+    fprintf(f, "{\"traceEvents\":[\n");
+    int first = 1;
+    int n = atomic_load(&buffer_count);
+    if (n > PROFILE_MAX_THREADS) n = PROFILE_MAX_THREADS;
+    for (int t = 0; t < n; t++) {
+        ProfileBuffer* b = buffers[t];
+        if (!b) continue;
+        uint64_t begin = b->count > PROFILE_BUFFER_SIZE ? b->count - PROFILE_BUFFER_SIZE : 0;
+        for (uint64_t i = begin; i < b->count; i++) {
+            const ProfileRecord* r = &b->records[i % PROFILE_BUFFER_SIZE];
+            fprintf(f, "%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+                    first ? "" : ",\n", r->name, b->thread_id,
+                    (r->start_ns - origin_ns) / 1000.0, r->duration_ns / 1000.0);
+            first = 0;
+        }
+    }
+    fprintf(f, "\n],\"displayTimeUnit\":\"ms\"}\n");
+    fclose(f);
+    return 1;
+}
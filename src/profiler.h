@@ -0,0 +1,31 @@
+/**
+ * @file profiler.h
+ * @brief Profileur par zones (chronomètres de portée) avec export au format Chrome Trace / Perfetto.
+ * @details Compilé uniquement avec -DPROFILING (make PROFILE=1) : sinon les macros ne génèrent aucun code.
+ *          Chaque thread écrit dans son propre tampon circulaire, sans verrou.
+ */
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <stdint.h>
+
+typedef struct { const char* name; uint64_t start_ns; } ProfileZone;
+
+#ifdef PROFILING
+    #define PROFILE_BEGIN(zone, name) ProfileZone zone = profiler_begin(name)
+    #define PROFILE_END(zone) profiler_end(&zone)
+#else
+    #define PROFILE_BEGIN(zone, name) ((void)0)
+    #define PROFILE_END(zone) ((void)0)
+#endif
+
+int profiler_available(); // 1 si compilé avec PROFILING
+void profiler_enable(int enabled);
+ProfileZone profiler_begin(const char* name);
+void profiler_end(const ProfileZone* zone);
+
+// Écrit toutes les zones enregistrées (tous threads) au format JSON Chrome Trace
+int profiler_write_trace(const char* path);
+
+#endif
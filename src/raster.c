@@ -0,0 +1,207 @@
+/**
+ * @file raster.c
+ * @brief Implémentation du rasteriseur logiciel basse résolution.
+ * @details Chaque sprite est réduit une fois en deux plans (couleur et masque 0x00/0xFF) dont les lignes
+ * sont complétées à 16 octets avec un masque nul : le blit d'une ligne se fait alors par blocs de 16 octets
+ * dst = (dst & ~masque) | couleur, sans cas particulier pour les petits sprites.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "raster.h"
+#include "sprites.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+    #include <emmintrin.h>
+    #define RASTER_USE_SSE2 1
+#endif
+
+#define RASTER_BLOCK 16
+
+// Sprites pré-réduits : une entrée par couple (bitmap, couleur) utilisé au dessin
+typedef enum {
+    RS_PLAYER,
+    RS_ENEMY_RED,
+    RS_ENEMY_PINK,
+    RS_UFO,
+    RS_EXPLOSION,
+    RS_SHIELD_FULL,
+    RS_SHIELD_DAMAGED,
+    RS_SHIELD_CRITICAL,
+    RS_SHOT,
+    RS_ENEMY_SHOT,
+    RS_COUNT
+} RasterSpriteId;
+
+typedef struct {
+    int w, h;        // Taille en pixels cibles
+    int stride;      // Octets par ligne (multiple de RASTER_BLOCK, >= w * canaux)
+    uint8_t* color;  // h * stride
+    uint8_t* mask;   // h * stride, 0xFF là où le sprite est opaque
+} RasterSprite;
+
+struct Raster {
+    int width, height, channels;
+    float sx, sy;                 // Pixels cibles par unité de jeu
+    uint8_t background[3];
+    RasterSprite sprites[RS_COUNT];
+};
+
+// Couleurs reprises du rendu SDL (les boucliers sont pris à 10, 5 et 2 points de vie)
+static const struct { int bitmap; float w, h; uint8_t r, g, b; } sprite_sources[RS_COUNT] = {
+    [RS_PLAYER]          = { SPRITE_PLAYER,          PLAYER_W, 0,  50, 255, 100 },
+    [RS_ENEMY_RED]       = { SPRITE_ENEMY_1,         ENEMY_W,  0, 255,  50,  50 },
+    [RS_ENEMY_PINK]      = { SPRITE_ENEMY_1,         ENEMY_W,  0, 255,  80, 255 },
+    [RS_UFO]             = { SPRITE_UFO,             UFO_W,    0,   0, 255, 255 },
+    [RS_EXPLOSION]       = { SPRITE_EXPLOSION,       ENEMY_W,  0, 255, 160,   0 },
+    [RS_SHIELD_FULL]     = { SPRITE_SHIELD_FULL,     SHIELD_W, 0,   0, 250, 255 },
+    [RS_SHIELD_DAMAGED]  = { SPRITE_SHIELD_DAMAGED,  SHIELD_W, 0, 125, 125, 255 },
+    [RS_SHIELD_CRITICAL] = { SPRITE_SHIELD_CRITICAL, SHIELD_W, 0, 200,  50,  50 },
+    [RS_SHOT]            = { -1,                     SHOT_W,   SHOT_H, 255, 255,   0 },
+    [RS_ENEMY_SHOT]      = { -1,                     SHOT_W,   SHOT_H, 200, 200, 255 },
+};
+
+static void put_color(const Raster* r, uint8_t* dst, uint8_t red, uint8_t green, uint8_t blue) {
+    if (r->channels == 1) dst[0] = (uint8_t)((77 * red + 150 * green + 29 * blue) >> 8);
+    else { dst[0] = red; dst[1] = green; dst[2] = blue; }
+}
+
+static int round_up(int v, int m) { return (v + m - 1) / m * m; }
+
+/**
+ * @brief Réduit un sprite à la résolution cible : un pixel cible est opaque si un des pixels sources qu'il couvre l'est.
+ * @details Conserver tout pixel touché évite que les sprites fins (tirs, épaves de bouclier) disparaissent en 84x84.
+ */
+static int bake_sprite(Raster* r, RasterSpriteId id) {
+    RasterSprite* s = &r->sprites[id];
+    const SpriteDef* def = sprite_sources[id].bitmap >= 0 ? &sprite_defs[sprite_sources[id].bitmap] : NULL;
+    float game_w = sprite_sources[id].w;
+    float game_h = def ? game_w * def->h / def->w : sprite_sources[id].h; // Même facteur d'échelle que le rendu SDL
+
+    s->w = (int)(game_w * r->sx + 0.999f); if (s->w < 1) s->w = 1;
+    s->h = (int)(game_h * r->sy + 0.999f); if (s->h < 1) s->h = 1;
+    s->stride = round_up(s->w * r->channels, RASTER_BLOCK);
+    s->color = calloc((size_t)s->h * s->stride, 1);
+    s->mask = calloc((size_t)s->h * s->stride, 1);
+    if (!s->color || !s->mask) return 0;
+
+    for (int y = 0; y < s->h; y++) {
+        for (int x = 0; x < s->w; x++) {
+            int on = 1;
+            if (def) {
+                int u0 = (int)(x * def->w / (s->w * 1.0f)), u1 = (int)((x + 1) * def->w / (s->w * 1.0f) - 0.001f);
+                int v0 = (int)(y * def->h / (s->h * 1.0f)), v1 = (int)((y + 1) * def->h / (s->h * 1.0f) - 0.001f);
+                if (u1 >= def->w) u1 = def->w - 1;
+                if (v1 >= def->h) v1 = def->h - 1;
+                on = 0;
+                for (int v = v0; v <= v1 && !on; v++) for (int u = u0; u <= u1 && !on; u++) on = sprite_pixel(def, u, v);
+            }
+            if (!on) continue;
+            uint8_t* c = s->color + y * s->stride + x * r->channels;
+            put_color(r, c, sprite_sources[id].r, sprite_sources[id].g, sprite_sources[id].b);
+            memset(s->mask + y * s->stride + x * r->channels, 0xFF, r->channels);
+        }
+    }
+    return 1;
+}
+
+Raster* raster_create(int width, int height, RasterFormat format) {
+    if (width <= 0 || height <= 0 || (format != RASTER_GRAY && format != RASTER_RGB)) return NULL;
+    Raster* r = calloc(1, sizeof(Raster));
+    if (!r) return NULL;
+    r->width = width;
+    r->height = height;
+    r->channels = (int)format;
+    r->sx = (float)width / GAME_WIDTH;
+    r->sy = (float)height / GAME_HEIGHT;
+    put_color(r, r->background, 5, 5, 20);
+
+    for (int i = 0; i < RS_COUNT; i++) {
+        if (!bake_sprite(r, (RasterSpriteId)i)) { raster_destroy(r); return NULL; }
+    }
+    return r;
+}
+
+void raster_destroy(Raster* r) {
+    if (!r) return;
+    for (int i = 0; i < RS_COUNT; i++) {
+        free(r->sprites[i].color);
+        free(r->sprites[i].mask);
+    }
+    free(r);
+}
+
+size_t raster_frame_size(const Raster* r) {
+    return (size_t)r->width * r->height * r->channels;
+}
+
+/**
+ * @brief Copie masquée de n octets. Les blocs complets passent par SSE2, le reste octet par octet.
+ */
+static void blit_row(uint8_t* dst, const uint8_t* color, const uint8_t* mask, int n) {
+    int i = 0;
+#ifdef RASTER_USE_SSE2
+    for (; i + RASTER_BLOCK <= n; i += RASTER_BLOCK) {
+        __m128i d = _mm_loadu_si128((const __m128i*)(dst + i));
+        __m128i m = _mm_loadu_si128((const __m128i*)(mask + i));
+        __m128i c = _mm_loadu_si128((const __m128i*)(color + i));
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_or_si128(_mm_andnot_si128(m, d), c));
+    }
+#endif
+    for (; i < n; i++) dst[i] = (dst[i] & ~mask[i]) | color[i];
+}
+
+/**
+ * @brief Dessine un sprite pré-réduit à la position de jeu (x, y), avec découpage aux bords.
+ */
+static void blit_sprite(const Raster* r, uint8_t* out, RasterSpriteId id, float x, float y) {
+    const RasterSprite* s = &r->sprites[id];
+    int px = (int)(x * r->sx), py = (int)(y * r->sy);
+    int col0 = px < 0 ? -px : 0, row0 = py < 0 ? -py : 0;
+    int col1 = px + s->w > r->width ? r->width - px : s->w;
+    int row1 = py + s->h > r->height ? r->height - py : s->h;
+    if (col0 >= col1 || row0 >= row1) return;
+
+    int ch = r->channels;
+    int row_bytes = r->width * ch;
+    int dst_x = (px + col0) * ch;
+    // Bloc entier : les octets de remplissage ont un masque nul et laissent la destination intacte
+    int n = round_up((col1 - col0) * ch, RASTER_BLOCK);
+    if (col0 * ch + n > s->stride || dst_x + n > row_bytes) n = (col1 - col0) * ch;
+
+    for (int row = row0; row < row1; row++) {
+        int off = row * s->stride + col0 * ch;
+        blit_row(out + (size_t)(py + row) * row_bytes + dst_x, s->color + off, s->mask + off, n);
+    }
+}
+
+void raster_draw(const Raster* r, const GameState* state, uint8_t* out) {
+    int row_bytes = r->width * r->channels;
+    if (r->channels == 1) {
+        memset(out, r->background[0], (size_t)r->height * row_bytes);
+    } else {
+        for (int x = 0; x < r->width; x++) memcpy(out + x * 3, r->background, 3);
+        for (int y = 1; y < r->height; y++) memcpy(out + (size_t)y * row_bytes, out, row_bytes);
+    }
+
+    for (int i = 0; i < MAX_SHIELDS; i++) {
+        const Shield* sh = &state->shields[i];
+        if (!sh->active || sh->health <= 0) continue;
+        RasterSpriteId id = RS_SHIELD_FULL + (sprite_shield_for_health(sh->health) - SPRITE_SHIELD_FULL);
+        blit_sprite(r, out, id, sh->pos.x, sh->pos.y);
+    }
+    for (int i = 0; i < state->enemy_count; i++) {
+        if (state->enemies[i].alive) blit_sprite(r, out, state->enemies[i].type % 2 == 0 ? RS_ENEMY_RED : RS_ENEMY_PINK, state->enemies[i].pos.x, state->enemies[i].pos.y);
+    }
+    if (state->ufo.active) blit_sprite(r, out, RS_UFO, state->ufo.x, state->ufo.y);
+    blit_sprite(r, out, RS_PLAYER, state->pos.x, state->pos.y);
+    for (int i = 0; i < MAX_SHOTS; i++) {
+        if (state->shots[i].active) blit_sprite(r, out, RS_SHOT, state->shots[i].pos.x, state->shots[i].pos.y);
+    }
+    for (int i = 0; i < MAX_ENEMY_SHOTS; i++) {
+        if (state->enemy_shots[i].active) blit_sprite(r, out, RS_ENEMY_SHOT, state->enemy_shots[i].pos.x, state->enemy_shots[i].pos.y);
+    }
+    for (int i = 0; i < MAX_EXPLOSIONS; i++) {
+        if (state->explosions[i].active) blit_sprite(r, out, RS_EXPLOSION, state->explosions[i].x, state->explosions[i].y);
+    }
+}
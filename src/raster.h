@@ -0,0 +1,40 @@
+/**
+ * @file raster.h
+ * @brief Rasteriseur logiciel basse résolution (observations en pixels pour les agents).
+ * @details Dessine un GameState dans un buffer 8 bits (niveaux de gris ou RGB) fourni par l'appelant,
+ *          sans SDL. Les sprites sont pré-réduits à la résolution cible par raster_create(),
+ *          raster_draw() ne fait plus que des copies de lignes masquées (SSE2 si disponible).
+ *          Un Raster est en lecture seule après création : plusieurs threads peuvent le partager.
+ */
+
+#ifndef RASTER_H
+#define RASTER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "model.h"
+
+typedef enum {
+    RASTER_GRAY = 1, // 1 octet par pixel (luminance)
+    RASTER_RGB = 3   // 3 octets par pixel, entrelacés
+} RasterFormat;
+
+typedef struct Raster Raster;
+
+/**
+ * @brief Prépare un rasteriseur pour une résolution donnée (ex : 84x84).
+ * @return NULL si la taille est invalide ou en cas d'échec d'allocation.
+ */
+Raster* raster_create(int width, int height, RasterFormat format);
+void raster_destroy(Raster* r);
+
+// Taille en octets d'une image (width * height * canaux, lignes contiguës)
+size_t raster_frame_size(const Raster* r);
+
+/**
+ * @brief Dessine l'état (fond, boucliers, ennemis, UFO, joueur, tirs, explosions) dans out.
+ * @details Pas de HUD ni d'étoiles : l'image ne dépend que de l'état, jamais de l'horloge.
+ */
+void raster_draw(const Raster* r, const GameState* state, uint8_t* out);
+
+#endif
@@ -0,0 +1,103 @@
+/**
+ * @file render_bench.c
+ * @brief Implémentation du benchmark de rendu headless.
+ * @details Les états sont produits par le vrai modèle avec des entrées scriptées (déplacements, tirs),
+ * entrecoupés de frames en pause et d'écrans de game over, pour couvrir toutes les branches du rendu.
+ */
+
+#include <SDL3/SDL.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "render_bench.h"
+#include "view_sdl.h"
+#include "model.h"
+
+#define RENDER_BENCH_SEED 4242
+#define PAUSE_PERIOD 600    // Toutes les 600 frames...
+#define PAUSE_FRAMES 30     // ...30 frames avec le menu pause
+#define GAME_OVER_FRAMES 60 // Durée de l'écran de game over avant de relancer
+
+/**
+ * @brief Entrées scriptées : aller-retours du joueur et tir toutes les 8 frames.
+ */
+static void scripted_input(GameState* s, int frame) {
+    if ((frame / 90) % 2 == 0) model_move_right(s);
+    else model_move_left(s);
+    if (frame % 8 == 0) model_shoot(s);
+}
+
+/**
+ * @brief Écrit la surface XRGB8888 au format PPM binaire (P6).
+ */
+static int write_ppm(SDL_Surface* surface, const char* path) {
+    FILE* f = fopen(path, "wb");
+    if (!f) return 0;
+    fprintf(f, "P6\n%d %d\n255\n", surface->w, surface->h);
+    SDL_LockSurface(surface);
+    unsigned char* row = malloc(surface->w * 3);
+    for (int y = 0; y < surface->h; y++) {
+        const Uint32* px = (const Uint32*)((const Uint8*)surface->pixels + y * surface->pitch);
+        for (int x = 0; x < surface->w; x++) {
+            row[x * 3] = (px[x] >> 16) & 0xFF;
+            row[x * 3 + 1] = (px[x] >> 8) & 0xFF;
+            row[x * 3 + 2] = px[x] & 0xFF;
+        }
+        fwrite(row, 1, surface->w * 3, f);
+    }
+    free(row);
+    SDL_UnlockSurface(surface);
+    fclose(f);
+    return 1;
+}
+
+int render_bench_run(int frames, const char* dump_dir) {
+    if (!view_sdl_init_headless(GAME_WIDTH, GAME_HEIGHT)) {
+        printf("Renderer logiciel indisponible : %s\n", SDL_GetError());
+        return 0;
+    }
+    srand(RENDER_BENCH_SEED); // Étoiles du fond
+    GameState state = {0};
+    model_seed(&state, RENDER_BENCH_SEED);
+    model_new_game(&state, NULL);
+
+    Uint64 freq = SDL_GetPerformanceFrequency();
+    Uint64 render_ticks = 0, worst_ticks = 0;
+    long total_draw_calls = 0;
+    int game_over_frames = 0, dumped = 0;
+
+    for (int frame = 0; frame < frames; frame++) {
+        int paused = (frame % PAUSE_PERIOD) >= PAUSE_PERIOD - PAUSE_FRAMES;
+        if (state.game_over) {
+            if (++game_over_frames > GAME_OVER_FRAMES) { model_new_game(&state, &state.rules); game_over_frames = 0; }
+        } else if (!paused) {
+            scripted_input(&state, frame);
+            model_tick(&state);
+            model_clear_events(&state);
+        }
+
+        Uint64 start = SDL_GetPerformanceCounter();
+        view_sdl_render(&state, paused, 0);
+        Uint64 elapsed = SDL_GetPerformanceCounter() - start;
+        render_ticks += elapsed;
+        if (elapsed > worst_ticks) worst_ticks = elapsed;
+        total_draw_calls += view_sdl_get_draw_calls();
+
+        if (dump_dir) {
+            char path[512];
+            snprintf(path, sizeof(path), "%s/frame_%05d.ppm", dump_dir, frame);
+            if (write_ppm(view_sdl_get_offscreen(), path)) dumped++;
+            else if (dumped == 0) { printf("Impossible d'écrire %s : export PPM désactivé\n", path); dump_dir = NULL; }
+        }
+    }
+
+    double total_s = (double)render_ticks / freq;
+    printf("--- Rendu headless (renderer logiciel, %dx%d) ---\n", GAME_WIDTH, GAME_HEIGHT);
+    printf("  Frames          : %d\n", frames);
+    printf("  Images/s        : %.1f\n", frames / (total_s > 0 ? total_s : 1e-9));
+    printf("  Temps moyen     : %.3f ms (pire %.3f ms)\n", total_s * 1000.0 / frames, worst_ticks * 1000.0 / freq);
+    printf("  Draw calls/frame: %.1f\n", (double)total_draw_calls / frames);
+    if (dumped) printf("  %d images PPM écrites dans %s\n", dumped, dump_dir);
+
+    view_sdl_shutdown();
+    return 1;
+}
@@ -0,0 +1,17 @@
+/**
+ * @file render_bench.h
+ * @brief Benchmark de rendu sans fenêtre (option --render-bench).
+ * @details Rejoue des états de jeu scriptés à travers view_sdl_render sur un renderer logiciel hors écran.
+ */
+
+#ifndef RENDER_BENCH_H
+#define RENDER_BENCH_H
+
+/**
+ * @brief Rend `frames` images et affiche images/s et appels de dessin par image.
+ * @param dump_dir Dossier où écrire chaque image au format PPM (NULL : aucun export).
+ * @return 1 si succès, 0 si le renderer logiciel n'a pas pu être créé.
+ */
+int render_bench_run(int frames, const char* dump_dir);
+
+#endif
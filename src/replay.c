@@ -0,0 +1,296 @@
+/**
+ * @file replay.c
+ * @brief Implémentation des replays : écriture en flux (plages d'entrées, images clés) et lecture avec index.
+ * @details L'écrivain accumule en mémoire (tampons doublés à la demande, jamais par tick) et écrit le
+ * fichier d'un bloc. Le lecteur charge le fichier entier : l'index et les images clés sont lus en place.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "replay.h"
+#include "waves.h"
+#include "behavior.h"
+
+_Static_assert(sizeof(ReplayHeader) == 88, "ReplayHeader fait partie du format de fichier");
+_Static_assert(sizeof(ReplayIndexEntry) == 16, "ReplayIndexEntry fait partie du format de fichier");
+
+struct ReplayWriter {
+    ReplayHeader header;
+    InputType run_input;
+    uint64_t run_length;       // Plage en cours, écrite quand l'entrée change
+    uint8_t* inputs;
+    size_t inputs_capacity;
+    ReplayIndexEntry* index;
+    ModelSnapshot* keyframes;
+    uint32_t keyframe_capacity;
+    int failed;                // Allocation impossible : replay_writer_save échouera
+};
+
+struct Replay {
+    ReplayHeader header;
+    uint8_t* data;
+    const ReplayIndexEntry* index;
+    const ModelSnapshot* keyframes; // NULL si absentes
+    const uint8_t* inputs;
+};
+
+void replay_start_state(GameState* state, uint64_t seed, int player_speed) {
+    GameSettings settings = state->settings;
+    GameRules rules = state->rules;
+    memset(state, 0, sizeof(*state));
+    state->settings = settings;
+    state->rules = rules;
+    state->settings.player_speed = player_speed;
+    model_seed(state, seed);
+    model_new_game(state, &rules);
+}
+
+// Règles d'une partie enregistrée : celles par défaut, plus la graine des niveaux procéduraux
+static void replay_rules(const ReplayHeader* h, GameRules* rules) {
+    model_default_rules(rules);
+    rules->wave_seed = h->waves_seed;
+}
+
+void replay_apply_input(GameState* state, InputType input) {
+    switch (input) {
+        case INPUT_LEFT: model_move_left(state); break;
+        case INPUT_RIGHT: model_move_right(state); break;
+        case INPUT_SHOOT: model_shoot(state); break;
+        default: break;
+    }
+}
+
+// --- ÉCRITURE ---
+
+ReplayWriter* replay_writer_create(uint64_t seed, int player_speed, int keyframe_interval) {
+    ReplayWriter* w = calloc(1, sizeof(ReplayWriter));
+    if (!w) return NULL;
+    w->header.magic = REPLAY_MAGIC;
+    w->header.version = REPLAY_VERSION;
+    w->header.snapshot_size = sizeof(ModelSnapshot);
+    w->header.player_speed = player_speed;
+    w->header.seed = seed;
+    w->header.waves_hash = waves_hash();
+    w->header.behaviors_hash = behavior_hash();
+    w->header.keyframe_interval = keyframe_interval > 0 ? (uint32_t)keyframe_interval : 0;
+    w->inputs_capacity = 256;
+    w->inputs = malloc(w->inputs_capacity);
+    if (!w->inputs) { free(w); return NULL; }
+    return w;
+}
+
+void replay_writer_destroy(ReplayWriter* w) {
+    if (!w) return;
+    free(w->inputs);
+    free(w->index);
+    free(w->keyframes);
+    free(w);
+}
+
+static void put_varint(ReplayWriter* w, uint64_t v) {
+    if (w->header.inputs_size + 10 > w->inputs_capacity) {
+        uint8_t* grown = realloc(w->inputs, w->inputs_capacity * 2);
+        if (!grown) { w->failed = 1; return; }
+        w->inputs = grown;
+        w->inputs_capacity *= 2;
+    }
+    while (v >= 0x80) { w->inputs[w->header.inputs_size++] = (uint8_t)(v | 0x80); v >>= 7; }
+    w->inputs[w->header.inputs_size++] = (uint8_t)v;
+}
+
+static void flush_run(ReplayWriter* w) {
+    if (w->run_length == 0) return;
+    put_varint(w, (w->run_length - 1) << 2 | (uint64_t)w->run_input);
+    w->run_length = 0;
+}
+
+static void add_keyframe(ReplayWriter* w, const GameState* state) {
+    if (w->header.keyframe_count == w->keyframe_capacity) {
+        uint32_t capacity = w->keyframe_capacity ? w->keyframe_capacity * 2 : 16;
+        ReplayIndexEntry* index = realloc(w->index, capacity * sizeof(ReplayIndexEntry));
+        if (index) w->index = index;
+        ModelSnapshot* keyframes = realloc(w->keyframes, capacity * sizeof(ModelSnapshot));
+        if (keyframes) w->keyframes = keyframes;
+        if (!index || !keyframes) { w->failed = 1; return; }
+        w->keyframe_capacity = capacity;
+    }
+    // La plage en cours n'est pas encore écrite : elle commencera à la fin actuelle du flux
+    w->index[w->header.keyframe_count] = (ReplayIndexEntry){ w->header.inputs_size, (uint32_t)w->run_length, 0 };
+    model_snapshot(state, &w->keyframes[w->header.keyframe_count++]);
+}
+
+void replay_writer_record(ReplayWriter* w, const GameState* state, InputType input) {
+    if (!w || w->failed) return;
+    if (input > INPUT_SHOOT) input = INPUT_NONE; // Touches de menu : sans effet sur la simulation
+    if (input != w->run_input || w->run_length >= UINT32_MAX) flush_run(w);
+    w->run_input = input;
+    if (w->header.keyframe_interval && w->header.tick_count % w->header.keyframe_interval == 0) add_keyframe(w, state);
+    w->run_length++;
+    w->header.tick_count++;
+}
+
+int replay_writer_save(ReplayWriter* w, const GameState* final_state, const char* path) {
+    if (!w) return 0;
+    flush_run(w);
+    if (w->failed) return 0;
+    w->header.final_score = final_state->score;
+    w->header.final_level = final_state->level;
+    w->header.final_hash = model_hash(final_state);
+    w->header.waves_seed = final_state->rules.wave_seed;
+
+    FILE* f = fopen(path, "wb");
+    if (!f) return 0;
+    uint32_t n = w->header.keyframe_count;
+    int ok = fwrite(&w->header, sizeof(ReplayHeader), 1, f) == 1
+          && fwrite(w->index, sizeof(ReplayIndexEntry), n, f) == n
+          && fwrite(w->keyframes, sizeof(ModelSnapshot), n, f) == n
+          && fwrite(w->inputs, 1, w->header.inputs_size, f) == w->header.inputs_size;
+    return fclose(f) == 0 && ok;
+}
+
+size_t replay_writer_size(const ReplayWriter* w) {
+    return sizeof(ReplayHeader) + w->header.keyframe_count * (sizeof(ReplayIndexEntry) + sizeof(ModelSnapshot)) + w->header.inputs_size;
+}
+
+// --- LECTURE ---
+
+Replay* replay_open(const char* path) {
+    FILE* f = fopen(path, "rb");
+    if (!f) return NULL;
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    Replay* r = calloc(1, sizeof(Replay));
+    if (!r || size < (long)sizeof(ReplayHeader) || !(r->data = malloc(size)) || fread(r->data, 1, size, f) != (size_t)size) {
+        fclose(f);
+        replay_close(r);
+        return NULL;
+    }
+    fclose(f);
+
+    ReplayHeader* h = &r->header;
+    memcpy(h, r->data, sizeof(ReplayHeader));
+    // Fichier soumis, donc non fiable : chaque partie est comparée aux octets restants (pas de débordement)
+    uint64_t left = (uint64_t)size - sizeof(ReplayHeader);
+    uint64_t index_size = (uint64_t)h->keyframe_count * sizeof(ReplayIndexEntry);
+    uint64_t keyframes_size = (uint64_t)h->keyframe_count * sizeof(ModelSnapshot);
+    if (h->magic != REPLAY_MAGIC || h->version != REPLAY_VERSION
+        || (h->keyframe_count && (!h->keyframe_interval || h->snapshot_size != sizeof(ModelSnapshot)))
+        || index_size > left || keyframes_size > left - index_size || h->inputs_size != left - index_size - keyframes_size) {
+        replay_close(r);
+        return NULL;
+    }
+    r->index = (const ReplayIndexEntry*)(r->data + sizeof(ReplayHeader));
+    r->inputs = r->data + sizeof(ReplayHeader) + index_size + keyframes_size;
+    if (h->keyframe_count) r->keyframes = (const ModelSnapshot*)(r->data + sizeof(ReplayHeader) + index_size);
+    // Les images clés sont rechargées telles quelles par replay_seek
+    for (uint32_t k = 0; k < h->keyframe_count; k++) {
+        if (!model_snapshot_valid(&r->keyframes[k])) {
+            replay_close(r);
+            return NULL;
+        }
+    }
+    return r;
+}
+
+void replay_close(Replay* r) {
+    if (!r) return;
+    free(r->data);
+    free(r);
+}
+
+const ReplayHeader* replay_header(const Replay* r) { return &r->header; }
+
+static int read_run(ReplayCursor* c) {
+    const Replay* r = c->replay;
+    uint64_t v = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        if (c->offset >= r->header.inputs_size) return 0;
+        uint8_t b = r->inputs[c->offset++];
+        v |= (uint64_t)(b & 0x7F) << shift;
+        if (!(b & 0x80)) {
+            c->input = (InputType)(v & 3);
+            c->run_left = (v >> 2) + 1;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int replay_cursor_next(ReplayCursor* c, InputType* input) {
+    if (c->tick >= c->replay->header.tick_count) return 0;
+    if (c->run_left == 0 && !read_run(c)) return 0;
+    c->run_left--;
+    c->tick++;
+    *input = c->input;
+    return 1;
+}
+
+int replay_seek(const Replay* r, uint64_t tick, GameState* state, ReplayCursor* cursor) {
+    const ReplayHeader* h = &r->header;
+    if (tick > h->tick_count) tick = h->tick_count;
+    *cursor = (ReplayCursor){ r, 0, 0, INPUT_NONE, 0 };
+    replay_rules(h, &state->rules); // Les images clés ne contiennent pas les règles
+
+    if (r->keyframes) {
+        uint64_t k = tick / h->keyframe_interval;
+        if (k >= h->keyframe_count) k = h->keyframe_count - 1;
+        const ReplayIndexEntry* e = &r->index[k];
+        cursor->offset = e->input_offset;
+        if (!read_run(cursor) || e->run_skip >= cursor->run_left) return 0;
+        cursor->run_left -= e->run_skip;
+        cursor->tick = k * h->keyframe_interval;
+        model_restore(state, &r->keyframes[k]);
+    } else {
+        replay_start_state(state, h->seed, h->player_speed);
+    }
+
+    InputType input;
+    while (cursor->tick < tick) {
+        if (!replay_cursor_next(cursor, &input)) return 0;
+        replay_apply_input(state, input);
+        model_tick(state);
+    }
+    model_clear_events(state);
+    return 1;
+}
+
+ReplayVerdict replay_verify(const Replay* r, GameState* final_state) {
+    const ReplayHeader* h = &r->header;
+    ReplayCursor cursor = { r, 0, 0, INPUT_NONE, 0 };
+    replay_rules(h, &final_state->rules);
+    replay_start_state(final_state, h->seed, h->player_speed);
+    if (h->player_speed < PLAYER_SPEED_MIN || h->player_speed > PLAYER_SPEED_MAX) return REPLAY_BAD_SPEED;
+    if (h->waves_hash != waves_hash()) return REPLAY_BAD_WAVES;
+    if (h->behaviors_hash != behavior_hash()) return REPLAY_BAD_BEHAVIORS;
+
+    InputType input;
+    while (cursor.tick < h->tick_count) {
+        if (final_state->game_over) return REPLAY_TICKS_AFTER_END;
+        if (!replay_cursor_next(&cursor, &input)) return REPLAY_BAD_INPUTS;
+        replay_apply_input(final_state, input);
+        model_tick(final_state);
+        model_clear_events(final_state);
+    }
+    if (cursor.run_left || cursor.offset != h->inputs_size) return REPLAY_BAD_INPUTS;
+    if (final_state->score != h->final_score) return REPLAY_BAD_SCORE;
+    if (final_state->level != h->final_level) return REPLAY_BAD_LEVEL;
+    if (model_hash(final_state) != h->final_hash) return REPLAY_BAD_HASH;
+    return REPLAY_VALID;
+}
+
+const char* replay_verdict_name(ReplayVerdict verdict) {
+    switch (verdict) {
+        case REPLAY_VALID: return "ok";
+        case REPLAY_BAD_INPUTS: return "entrees";
+        case REPLAY_TICKS_AFTER_END: return "apres_game_over";
+        case REPLAY_BAD_SCORE: return "score";
+        case REPLAY_BAD_LEVEL: return "niveau";
+        case REPLAY_BAD_HASH: return "empreinte";
+        case REPLAY_BAD_WAVES: return "niveaux";
+        case REPLAY_BAD_BEHAVIORS: return "comportements";
+        case REPLAY_BAD_SPEED: return "vitesse";
+    }
+    return "?";
+}
@@ -0,0 +1,116 @@
+/**
+ * @file replay.h
+ * @brief Format de replay compact : entrées codées en plages (RLE + varint), graine, images clés indexées.
+ * @details Disposition du fichier : ReplayHeader | index (ReplayIndexEntry * keyframe_count)
+ *          | images clés (ModelSnapshot * keyframe_count) | flux d'entrées.
+ *          Chaque plage d'entrées identiques est un varint ((longueur - 1) << 2 | entrée) : seules les
+ *          entrées qui agissent sur la simulation (NONE, LEFT, RIGHT, SHOOT) sont enregistrées.
+ *          La partie part toujours de replay_start_state(graine) ; les images clés (facultatives, toutes
+ *          les keyframe_interval ticks) ne servent qu'à la navigation : replay_seek restaure l'image clé
+ *          du tick demandé (accès direct par l'index) puis re-simule au plus keyframe_interval - 1 ticks.
+ */
+
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "model.h"
+
+#define REPLAY_MAGIC 0x31505249u // "IRP1"
+#define REPLAY_VERSION 5
+#define REPLAY_KEYFRAME_INTERVAL 300 // 5 s de jeu : replays enregistrés en partie (--record)
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t reserved;
+    uint32_t snapshot_size;      // sizeof(ModelSnapshot) à l'écriture : replay refusé si différent (avec images clés)
+    int32_t player_speed;
+    uint64_t seed;
+    uint64_t tick_count;
+    int32_t final_score;
+    int32_t final_level;
+    uint64_t final_hash;         // model_hash de l'état après le dernier tick
+    uint32_t keyframe_interval;  // 0 : pas d'images clés (archives)
+    uint32_t keyframe_count;
+    uint64_t inputs_size;        // Octets du flux d'entrées
+    uint64_t waves_hash;         // waves_hash() à l'enregistrement : la table des niveaux fait partie des règles
+    uint64_t waves_seed;         // GameRules.wave_seed de la partie (0 : table des niveaux)
+    uint64_t behaviors_hash;     // behavior_hash() à l'enregistrement : les comportements des ennemis aussi
+} ReplayHeader;
+
+typedef struct {
+    uint64_t input_offset;       // Début (dans le flux) de la plage qui contient le tick de l'image clé
+    uint32_t run_skip;           // Ticks de cette plage déjà joués avant l'image clé
+    uint32_t reserved;
+} ReplayIndexEntry;
+
+/**
+ * @brief Résultat de la vérification d'un replay soumis (re-simulation complète depuis la graine).
+ */
+typedef enum {
+    REPLAY_VALID,
+    REPLAY_BAD_INPUTS,        // Flux d'entrées tronqué, illisible ou plus long que tick_count
+    REPLAY_TICKS_AFTER_END,   // Des ticks sont joués après le game over
+    REPLAY_BAD_SCORE,
+    REPLAY_BAD_LEVEL,
+    REPLAY_BAD_HASH,          // Score et niveau corrects mais état final différent
+    REPLAY_BAD_WAVES,         // Enregistré avec une autre table des niveaux
+    REPLAY_BAD_BEHAVIORS,     // Enregistré avec d'autres comportements d'ennemis
+    REPLAY_BAD_SPEED          // Vitesse du joueur hors des valeurs du menu des paramètres
+} ReplayVerdict;
+
+typedef struct ReplayWriter ReplayWriter;
+typedef struct Replay Replay;
+
+/**
+ * @brief Position de lecture dans le flux d'entrées.
+ */
+typedef struct {
+    const Replay* replay;
+    uint64_t offset;             // Prochain varint à décoder
+    uint64_t run_left;           // Ticks restants dans la plage courante
+    InputType input;
+    uint64_t tick;               // Prochain tick à jouer
+} ReplayCursor;
+
+// État de départ canonique d'une partie enregistrée (préférences et règles de state conservées, hormis la vitesse)
+void replay_start_state(GameState* state, uint64_t seed, int player_speed);
+
+// keyframe_interval 0 : aucune image clé (archives de bots)
+ReplayWriter* replay_writer_create(uint64_t seed, int player_speed, int keyframe_interval);
+void replay_writer_destroy(ReplayWriter* w);
+
+// À appeler juste avant model_tick, avec l'état d'avant le tick et l'entrée appliquée
+void replay_writer_record(ReplayWriter* w, const GameState* state, InputType input);
+
+// Écrit le fichier ; final_state (après le dernier tick) fournit score, niveau et empreinte
+int replay_writer_save(ReplayWriter* w, const GameState* final_state, const char* path);
+
+// Taille du fichier écrit par replay_writer_save
+size_t replay_writer_size(const ReplayWriter* w);
+
+// Charge un fichier en mémoire et vérifie sa cohérence (tailles, images clés), NULL si invalide
+Replay* replay_open(const char* path);
+void replay_close(Replay* r);
+const ReplayHeader* replay_header(const Replay* r);
+
+// Place state avant le tick demandé (borné à tick_count) et le curseur sur ce tick ; 0 si le flux d'entrées
+// s'interrompt avant (state est alors à moitié rejoué : la lecture doit s'arrêter)
+int replay_seek(const Replay* r, uint64_t tick, GameState* state, ReplayCursor* cursor);
+
+// Entrée du prochain tick ; 0 à la fin du replay ou si le flux est corrompu
+int replay_cursor_next(ReplayCursor* c, InputType* input);
+
+/**
+ * @brief Rejoue tout le replay depuis replay_start_state (images clés ignorées : elles ne sont pas vérifiées)
+ *        et compare score, niveau et empreinte annoncés. final_state reçoit l'état obtenu.
+ */
+ReplayVerdict replay_verify(const Replay* r, GameState* final_state);
+const char* replay_verdict_name(ReplayVerdict verdict);
+
+// Applique une entrée enregistrée (déplacement, tir) avant model_tick
+void replay_apply_input(GameState* state, InputType input);
+
+#endif
@@ -0,0 +1,175 @@
+/**
+ * @file rewind.c
+ * @brief Implémentation du tampon de retour arrière (images clés + entrées, re-simulation).
+ * @details Le gestionnaire de plantage n'utilise que open/write/close sur des tampons déjà en mémoire
+ * (fonctions sûres dans un gestionnaire de signal), puis relance le signal avec le comportement par défaut.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include "rewind.h"
+#include "replay.h"
+
+#ifndef _WIN32
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+static const int crash_signals[] = { SIGSEGV, SIGABRT, SIGFPE, SIGILL
+#ifdef SIGBUS
+    , SIGBUS
+#endif
+};
+
+static const RewindBuffer* crash_buffer = NULL;
+static char crash_path[256];
+
+int rewind_init(RewindBuffer* rb, int capacity, int interval) {
+    memset(rb, 0, sizeof(*rb));
+    if (interval <= 0 || capacity < interval) return 0;
+    capacity -= capacity % interval;
+    rb->keyframes = malloc((size_t)(capacity / interval) * sizeof(ModelSnapshot));
+    rb->inputs = malloc((size_t)capacity);
+    if (!rb->keyframes || !rb->inputs) { rewind_destroy(rb); return 0; }
+    rb->capacity = capacity;
+    rb->interval = interval;
+    rb->keyframe_count = capacity / interval;
+    return 1;
+}
+
+void rewind_destroy(RewindBuffer* rb) {
+    if (crash_buffer == rb) rewind_install_crash_dump(NULL, NULL);
+    free(rb->keyframes);
+    free(rb->inputs);
+    memset(rb, 0, sizeof(*rb));
+}
+
+void rewind_clear(RewindBuffer* rb) {
+    rb->start = rb->end = 0;
+}
+
+void rewind_record(RewindBuffer* rb, const GameState* state, InputType input) {
+    if (!rb->capacity) return;
+    if (rb->end % rb->interval == 0) {
+        if (rb->end - rb->start >= (uint64_t)rb->capacity) rb->start += rb->interval; // L'image clé la plus ancienne est écrasée
+        model_snapshot(state, &rb->keyframes[(rb->end / rb->interval) % rb->keyframe_count]);
+        rb->rules = state->rules;
+    }
+    rb->inputs[rb->end % rb->capacity] = (uint8_t)input;
+    rb->end++;
+}
+
+static void replay_tick(const RewindBuffer* rb, uint64_t t, GameState* state) {
+    replay_apply_input(state, (InputType)rb->inputs[t % rb->capacity]);
+    model_tick(state);
+}
+
+/**
+ * @brief Reconstruit l'état d'avant le tick t (start <= t < end) : image clé puis re-simulation des entrées.
+ */
+static void reconstruct(const RewindBuffer* rb, uint64_t t, GameState* state) {
+    uint64_t key = t - t % rb->interval;
+    model_restore(state, &rb->keyframes[(key / rb->interval) % rb->keyframe_count]);
+    for (uint64_t i = key; i < t; i++) replay_tick(rb, i, state);
+    model_clear_events(state);
+}
+
+int rewind_step_back(RewindBuffer* rb, GameState* state) {
+    if (rb->end == rb->start) return 0;
+    rb->end--;
+    reconstruct(rb, rb->end, state); // L'image clé de ce tick a été prise avant qu'on recule
+    return 1;
+}
+
+int rewind_available(const RewindBuffer* rb) {
+    return (int)(rb->end - rb->start);
+}
+
+#ifndef _WIN32
+
+static int write_all(int fd, const void* data, size_t size) {
+    const char* p = data;
+    while (size > 0) {
+        ssize_t n = write(fd, p, size);
+        if (n <= 0) return 0;
+        p += n;
+        size -= (size_t)n;
+    }
+    return 1;
+}
+
+int rewind_dump(const RewindBuffer* rb, const char* path) {
+    if (!rb->capacity) return 0;
+    RewindDumpHeader h = { REWIND_MAGIC, sizeof(ModelSnapshot), rb->capacity, rb->interval, rb->start, rb->end, rb->rules };
+    int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) return 0;
+    int ok = write_all(fd, &h, sizeof(h))
+          && write_all(fd, rb->keyframes, (size_t)rb->keyframe_count * sizeof(ModelSnapshot))
+          && write_all(fd, rb->inputs, (size_t)rb->capacity);
+    close(fd);
+    return ok;
+}
+
+#else
+
+int rewind_dump(const RewindBuffer* rb, const char* path) {
+    if (!rb->capacity) return 0;
+    RewindDumpHeader h = { REWIND_MAGIC, sizeof(ModelSnapshot), rb->capacity, rb->interval, rb->start, rb->end, rb->rules };
+    FILE* f = fopen(path, "wb");
+    if (!f) return 0;
+    int ok = fwrite(&h, sizeof(h), 1, f) == 1
+          && fwrite(rb->keyframes, sizeof(ModelSnapshot), rb->keyframe_count, f) == (size_t)rb->keyframe_count
+          && fwrite(rb->inputs, 1, rb->capacity, f) == (size_t)rb->capacity;
+    fclose(f);
+    return ok;
+}
+
+#endif
+
+int rewind_load(RewindBuffer* rb, GameState* state, const char* path) {
+    FILE* f = fopen(path, "rb");
+    if (!f) return 0;
+    RewindDumpHeader h;
+    if (fread(&h, sizeof(h), 1, f) != 1 || h.magic != REWIND_MAGIC || h.snapshot_size != sizeof(ModelSnapshot)
+        || h.end < h.start || h.end - h.start > (uint64_t)h.capacity || !rewind_init(rb, h.capacity, h.interval)
+        || rb->capacity != h.capacity) {
+        fclose(f);
+        return 0;
+    }
+    int ok = fread(rb->keyframes, sizeof(ModelSnapshot), rb->keyframe_count, f) == (size_t)rb->keyframe_count
+          && fread(rb->inputs, 1, rb->capacity, f) == (size_t)rb->capacity;
+    fclose(f);
+    // Vidage écrit au plantage, l'état était peut-être déjà corrompu : les images clés de la plage rejouée
+    // sont contrôlées avant toute re-simulation (les emplacements hors plage n'ont jamais été écrits)
+    for (uint64_t key = h.start - h.start % rb->interval; ok && key < h.end; key += rb->interval) {
+        ok = model_snapshot_valid(&rb->keyframes[(key / rb->interval) % rb->keyframe_count]);
+    }
+    if (!ok) { rewind_destroy(rb); return 0; }
+    rb->start = h.start;
+    rb->end = h.end;
+    rb->rules = state->rules = h.rules; // Hors des images clés : sans elles, la re-simulation divergerait
+    if (rb->end > rb->start) { // L'image clé de end n'existe pas forcément : on rejoue le dernier tick enregistré
+        reconstruct(rb, rb->end - 1, state);
+        replay_tick(rb, rb->end - 1, state);
+        model_clear_events(state);
+    }
+    return 1;
+}
+
+static void crash_handler(int sig) {
+    if (crash_buffer) rewind_dump(crash_buffer, crash_path);
+    signal(sig, SIG_DFL);
+    raise(sig);
+}
+
+void rewind_install_crash_dump(const RewindBuffer* rb, const char* path) {
+    crash_buffer = NULL;
+    for (size_t i = 0; i < sizeof(crash_signals) / sizeof(crash_signals[0]); i++) {
+        signal(crash_signals[i], rb && path ? crash_handler : SIG_DFL);
+    }
+    if (!rb || !path) return;
+    snprintf(crash_path, sizeof(crash_path), "%s", path);
+    crash_buffer = rb;
+}
@@ -0,0 +1,72 @@
+/**
+ * @file rewind.h
+ * @brief Retour arrière (rewind) et enregistreur de vol : les dernières secondes de simulation en mémoire.
+ * @details Tampon circulaire réservé une fois : un ModelSnapshot tous les REWIND_KEYFRAME_INTERVAL ticks
+ *          et l'entrée de chaque tick (1 octet). L'état d'un tick intermédiaire est recalculé depuis
+ *          l'image clé précédente avec model_tick (au plus interval - 1 ticks). Enregistrer un tick ne
+ *          fait ni allocation ni appel système : le tampon peut rester actif en permanence.
+ *          En cas de plantage, le tampon est écrit tel quel sur disque (rewind_install_crash_dump).
+ */
+
+#ifndef REWIND_H
+#define REWIND_H
+
+#include <stdint.h>
+#include "model.h"
+
+#define REWIND_SECONDS 10
+#define REWIND_TICKS_PER_SECOND 60
+#define REWIND_KEYFRAME_INTERVAL 4
+#define REWIND_MAGIC 0x32435249u // "IRC2" : Invaders Recorder (2 : règles de la partie dans l'en-tête)
+#define REWIND_DUMP_PATH "saves/flight_recorder.bin"
+
+typedef struct {
+    ModelSnapshot* keyframes; // keyframe_count images clés, la k-ième dans l'emplacement k % keyframe_count
+    uint8_t* inputs;          // capacity entrées (InputType), celle du tick t dans l'emplacement t % capacity
+    int capacity;             // Ticks conservés (multiple de interval)
+    int interval;
+    int keyframe_count;
+    uint64_t start;           // Plus ancien tick disponible (toujours une image clé)
+    uint64_t end;             // Prochain tick à enregistrer : l'état courant est celui d'avant ce tick
+    GameRules rules;          // Règles de la partie (hors des images clés), relevées à chaque image clé
+} RewindBuffer;
+
+/**
+ * @brief En-tête du fichier de l'enregistreur de vol, suivi des images clés puis des entrées (tampons bruts).
+ */
+typedef struct {
+    uint32_t magic;
+    uint32_t snapshot_size;   // sizeof(ModelSnapshot) : le fichier n'est relisible que par la même version
+    int32_t capacity;
+    int32_t interval;
+    uint64_t start;
+    uint64_t end;
+    GameRules rules;          // Règles de la partie (graine des niveaux procéduraux comprise), rétablies au chargement
+} RewindDumpHeader;
+
+int rewind_init(RewindBuffer* rb, int capacity, int interval);
+void rewind_destroy(RewindBuffer* rb);
+
+// Oublie l'historique (nouvelle partie, chargement) : le prochain tick enregistré devient le tick 0
+void rewind_clear(RewindBuffer* rb);
+
+// À appeler juste avant model_tick, avec l'état d'avant le tick et l'entrée appliquée pendant ce tick
+void rewind_record(RewindBuffer* rb, const GameState* state, InputType input);
+
+// Recule d'un tick : state reprend l'état d'avant le dernier tick enregistré. 0 si l'historique est vide.
+int rewind_step_back(RewindBuffer* rb, GameState* state);
+
+// Ticks disponibles pour le retour arrière
+int rewind_available(const RewindBuffer* rb);
+
+// Écrit le tampon (en-tête + images clés + entrées) ; utilisable depuis un gestionnaire de signal
+int rewind_dump(const RewindBuffer* rb, const char* path);
+
+// Relit un fichier de rewind_dump dans un tampon neuf et place state (règles comprises) au dernier tick enregistré ;
+// 0 si le fichier est invalide, images clés comprises (rien n'est alors re-simulé)
+int rewind_load(RewindBuffer* rb, GameState* state, const char* path);
+
+// Écrit le tampon dans path si le programme plante (SIGSEGV, SIGABRT...), NULL pour désinstaller
+void rewind_install_crash_dump(const RewindBuffer* rb, const char* path);
+
+#endif
@@ -0,0 +1,192 @@
+/**
+ * @file shm_env.c
+ * @brief Implémentation de l'environnement en mémoire partagée (serveur et client).
+ * @details Les parties sont simulées directement dans le segment : les GameState y vivent, les pixels
+ * y sont rasterisés, aucune donnée n'est recopiée entre le serveur et l'entraîneur.
+ */
+
+#define _DEFAULT_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include <limits.h>
+#include "shm_env.h"
+#include "model.h"
+#include "raster.h"
+
+#ifndef _WIN32
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <sched.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+#endif
+#ifdef __linux__
+    #include <sys/syscall.h>
+    #include <linux/futex.h>
+#endif
+
+#define SHM_ALIGN 64
+#define SPIN_ITERATIONS 4000 // Attente active avant de dormir : un step de lot dure quelques µs
+
+_Static_assert(offsetof(ShmEnvHeader, request) % SHM_ALIGN == 0, "request doit ouvrir une ligne de cache");
+_Static_assert(offsetof(ShmEnvHeader, response) % SHM_ALIGN == 0, "response doit ouvrir une ligne de cache");
+
+#ifndef _WIN32
+
+static uint64_t align_up(uint64_t v) { return (v + SHM_ALIGN - 1) & ~(uint64_t)(SHM_ALIGN - 1); }
+
+static void cpu_relax() {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#endif
+}
+
+/**
+ * @brief Attend que *addr soit différent de old : attente active courte puis futex (partagé entre processus).
+ */
+static uint32_t wait_change(uint32_t* addr, uint32_t old) {
+    uint32_t v;
+    for (int i = 0; i < SPIN_ITERATIONS; i++) {
+        if ((v = __atomic_load_n(addr, __ATOMIC_ACQUIRE)) != old) return v;
+        cpu_relax();
+    }
+    while ((v = __atomic_load_n(addr, __ATOMIC_ACQUIRE)) == old) {
+#ifdef __linux__
+        syscall(SYS_futex, addr, FUTEX_WAIT, old, NULL, NULL, 0);
+#else
+        sched_yield();
+#endif
+    }
+    return v;
+}
+
+static void publish(uint32_t* addr, uint32_t value) {
+    __atomic_store_n(addr, value, __ATOMIC_RELEASE);
+#ifdef __linux__
+    syscall(SYS_futex, addr, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+#endif
+}
+
+int shm_env_serve(const char* name, int num_envs, int obs_size) {
+    if (num_envs <= 0 || num_envs > SHM_ENV_MAX_ENVS || obs_size < 0) {
+        printf("Environnement : nombre de parties invalide (1-%d)\n", SHM_ENV_MAX_ENVS);
+        return 0;
+    }
+
+    ShmEnvHeader layout = {0};
+    layout.version = SHM_ENV_VERSION;
+    layout.num_envs = num_envs;
+    layout.state_size = sizeof(GameState);
+    layout.obs_width = layout.obs_height = obs_size;
+    layout.actions_offset = align_up(sizeof(ShmEnvHeader));
+    layout.rewards_offset = align_up(layout.actions_offset + num_envs * sizeof(int32_t));
+    layout.dones_offset = align_up(layout.rewards_offset + num_envs * sizeof(float));
+    layout.states_offset = align_up(layout.dones_offset + num_envs);
+    layout.pixels_offset = align_up(layout.states_offset + (uint64_t)num_envs * sizeof(GameState));
+    layout.total_size = align_up(layout.pixels_offset + (uint64_t)num_envs * obs_size * obs_size);
+
+    Raster* raster = NULL;
+    if (obs_size > 0 && !(raster = raster_create(obs_size, obs_size, RASTER_GRAY))) return 0;
+
+    shm_unlink(name); // Segment orphelin d'un serveur interrompu
+    int fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0) { perror("shm_open"); raster_destroy(raster); return 0; }
+    if (ftruncate(fd, layout.total_size) != 0) { perror("ftruncate"); close(fd); shm_unlink(name); raster_destroy(raster); return 0; }
+    unsigned char* base = mmap(NULL, layout.total_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) { perror("mmap"); shm_unlink(name); raster_destroy(raster); return 0; }
+
+    ShmEnvHeader* env = (ShmEnvHeader*)base;
+    int32_t* actions = (int32_t*)(base + layout.actions_offset);
+    float* rewards = (float*)(base + layout.rewards_offset);
+    uint8_t* dones = base + layout.dones_offset;
+    GameState* states = (GameState*)(base + layout.states_offset);
+    uint8_t* pixels = base + layout.pixels_offset;
+    size_t frame_size = (size_t)obs_size * obs_size;
+
+    for (int i = 0; i < num_envs; i++) {
+        model_seed(&states[i], (uint64_t)i);
+        model_reset_game(&states[i]);
+        if (raster) raster_draw(raster, &states[i], pixels + i * frame_size);
+    }
+    layout.magic = 0;
+    *env = layout;
+    __atomic_store_n(&env->magic, SHM_ENV_MAGIC, __ATOMIC_RELEASE); // En dernier : le client n'attache qu'un segment prêt
+    printf("Environnement %s : %d parties, %s (%.1f Ko)\n", name, num_envs,
+           obs_size ? "observations pixels" : "observations GameState", layout.total_size / 1024.0);
+
+    uint32_t seen = 0;
+    unsigned long steps = 0;
+    while (1) {
+        seen = wait_change(&env->request, seen);
+        uint32_t command = __atomic_load_n(&env->command, __ATOMIC_ACQUIRE);
+        if (command == SHM_ENV_CMD_CLOSE) { publish(&env->response, seen); break; }
+
+        for (int i = 0; i < num_envs; i++) {
+            if (command == SHM_ENV_CMD_RESET || dones[i]) { // Une partie terminée repart au step suivant
+                model_reset_game(&states[i]);
+                rewards[i] = 0;
+                dones[i] = 0;
+                if (command == SHM_ENV_CMD_RESET) { if (raster) raster_draw(raster, &states[i], pixels + i * frame_size); continue; }
+            }
+            int action = actions[i];
+            rewards[i] = model_step_action(&states[i], (action >= 0 && action < INV_ACTION_COUNT) ? action : INV_ACTION_NONE);
+            dones[i] = states[i].game_over != 0;
+            if (raster) raster_draw(raster, &states[i], pixels + i * frame_size);
+        }
+        if (command == SHM_ENV_CMD_STEP) steps++;
+        publish(&env->response, seen);
+    }
+
+    printf("Environnement fermé après %lu steps de lot (%lu ticks)\n", steps, steps * num_envs);
+    munmap(base, layout.total_size);
+    shm_unlink(name);
+    raster_destroy(raster);
+    return 1;
+}
+
+ShmEnvHeader* shm_env_attach(const char* name) {
+    int fd = shm_open(name, O_RDWR, 0);
+    if (fd < 0) return NULL;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(ShmEnvHeader)) { close(fd); return NULL; }
+    void* base = mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) return NULL;
+
+    ShmEnvHeader* env = (ShmEnvHeader*)base;
+    if (__atomic_load_n(&env->magic, __ATOMIC_ACQUIRE) != SHM_ENV_MAGIC || env->version != SHM_ENV_VERSION
+        || env->state_size != sizeof(GameState) || env->total_size != (uint64_t)st.st_size) {
+        munmap(base, st.st_size);
+        return NULL;
+    }
+    return env;
+}
+
+void shm_env_detach(ShmEnvHeader* env) {
+    if (env) munmap(env, env->total_size);
+}
+
+void shm_env_call(ShmEnvHeader* env, ShmEnvCommand command) {
+    uint32_t request = env->request + 1;
+    __atomic_store_n(&env->command, (uint32_t)command, __ATOMIC_RELAXED);
+    publish(&env->request, request);
+    uint32_t seen = __atomic_load_n(&env->response, __ATOMIC_ACQUIRE);
+    while (seen != request) seen = wait_change(&env->response, seen);
+}
+
+#else
+
+int shm_env_serve(const char* name, int num_envs, int obs_size) {
+    (void)name; (void)num_envs; (void)obs_size;
+    printf("Environnement en mémoire partagée indisponible sur cette plateforme\n");
+    return 0;
+}
+
+ShmEnvHeader* shm_env_attach(const char* name) { (void)name; return NULL; }
+void shm_env_detach(ShmEnvHeader* env) { (void)env; }
+void shm_env_call(ShmEnvHeader* env, ShmEnvCommand command) { (void)env; (void)command; }
+
+#endif
@@ -0,0 +1,72 @@
+/**
+ * @file shm_env.h
+ * @brief Environnement step/reset en mémoire partagée pour des agents externes (option --env).
+ * @details Le jeu crée un segment POSIX (shm_open) contenant un lot de parties. L'entraîneur (C, C++, Python...)
+ *          y écrit les actions puis incrémente `request` ; le serveur simule toutes les parties sur place
+ *          et incrémente `response`. Aucune copie : les GameState, récompenses, fins de partie et pixels
+ *          sont lus directement dans le segment. Synchronisation par attente active courte puis futex.
+ *
+ *          Disposition : ShmEnvHeader, puis aux offsets indiqués dans l'en-tête (alignés sur 64 octets) :
+ *          actions[num_envs] (int32, codes InvAction de invaders.h), rewards[num_envs] (float), dones[num_envs] (uint8),
+ *          states[num_envs] (GameState), pixels[num_envs][obs_height][obs_width] (uint8, si obs_width > 0).
+ */
+
+#ifndef SHM_ENV_H
+#define SHM_ENV_H
+
+#include <stdint.h>
+#include "invaders.h" // Codes d'action (InvAction), communs avec libinvaders
+
+#define SHM_ENV_MAGIC 0x53564E49u // "INVS"
+#define SHM_ENV_VERSION 1
+#define SHM_ENV_MAX_ENVS 65536
+
+typedef enum {
+    SHM_ENV_CMD_STEP = 1,  // Avance chaque partie d'un tick avec son action
+    SHM_ENV_CMD_RESET = 2, // Réinitialise toutes les parties
+    SHM_ENV_CMD_CLOSE = 3  // Arrête le serveur et supprime le segment
+} ShmEnvCommand;
+
+/**
+ * @brief En-tête du segment. Les compteurs sont sur des lignes de cache distinctes (un écrivain chacun).
+ * @details Un step : écrire actions[] et command, puis request += 1 (release) et futex_wake(&request).
+ *          Le résultat est prêt quand response == request (acquire).
+ */
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t num_envs;
+    uint32_t state_size;      // sizeof(GameState) côté serveur, à vérifier par le client
+    uint32_t obs_width;       // 0 : pas d'observation pixels
+    uint32_t obs_height;
+    uint64_t actions_offset;
+    uint64_t rewards_offset;
+    uint64_t dones_offset;
+    uint64_t states_offset;
+    uint64_t pixels_offset;
+    uint64_t total_size;
+    uint32_t command;         // ShmEnvCommand, écrit par le client avant request
+    uint8_t pad0[52];
+    uint32_t request;         // Écrit par le client
+    uint8_t pad1[60];
+    uint32_t response;        // Écrit par le serveur
+    uint8_t pad2[60];
+} ShmEnvHeader;
+
+/**
+ * @brief Crée le segment `name` (ex : "/invaders") et sert les requêtes jusqu'à SHM_ENV_CMD_CLOSE.
+ * @param obs_size Côté des observations pixels en niveaux de gris (ex : 84), 0 pour n'exposer que les GameState.
+ * @return 1 si le serveur s'est arrêté proprement, 0 en cas d'erreur.
+ */
+int shm_env_serve(const char* name, int num_envs, int obs_size);
+
+// --- CÔTÉ CLIENT (entraîneur en C/C++) ---
+
+// Ouvre un segment existant, NULL si absent ou incompatible
+ShmEnvHeader* shm_env_attach(const char* name);
+void shm_env_detach(ShmEnvHeader* env);
+
+// Envoie une commande (actions déjà écrites) et attend la réponse du serveur
+void shm_env_call(ShmEnvHeader* env, ShmEnvCommand command);
+
+#endif
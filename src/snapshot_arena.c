@@ -0,0 +1,47 @@
+/**
+ * @file snapshot_arena.c
+ * @brief Implémentation du pool d'instantanés (tableau contigu + liste libre d'indices).
+ */
+
+#include <stdlib.h>
+#include "snapshot_arena.h"
+
+int snapshot_arena_init(SnapshotArena* arena, int capacity) {
+    arena->slots = NULL;
+    arena->free_list = NULL;
+    arena->capacity = arena->used = arena->free_count = 0;
+    if (capacity <= 0) return 0;
+    arena->slots = malloc((size_t)capacity * sizeof(ModelSnapshot));
+    arena->free_list = malloc((size_t)capacity * sizeof(int));
+    if (!arena->slots || !arena->free_list) { snapshot_arena_destroy(arena); return 0; }
+    arena->capacity = capacity;
+    return 1;
+}
+
+void snapshot_arena_destroy(SnapshotArena* arena) {
+    free(arena->slots);
+    free(arena->free_list);
+    arena->slots = NULL;
+    arena->free_list = NULL;
+    arena->capacity = arena->used = arena->free_count = 0;
+}
+
+ModelSnapshot* snapshot_arena_alloc(SnapshotArena* arena) {
+    if (arena->free_count > 0) return &arena->slots[arena->free_list[--arena->free_count]];
+    if (arena->used < arena->capacity) return &arena->slots[arena->used++];
+    return NULL;
+}
+
+void snapshot_arena_free(SnapshotArena* arena, ModelSnapshot* snap) {
+    if (!snap) return;
+    arena->free_list[arena->free_count++] = (int)(snap - arena->slots);
+}
+
+void snapshot_arena_reset(SnapshotArena* arena) {
+    arena->used = 0;
+    arena->free_count = 0;
+}
+
+int snapshot_arena_live(const SnapshotArena* arena) {
+    return arena->used - arena->free_count;
+}
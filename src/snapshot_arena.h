@@ -0,0 +1,35 @@
+/**
+ * @file snapshot_arena.h
+ * @brief Pool d'instantanés de simulation pour les bots de recherche (aucun malloc par décision).
+ * @details La mémoire est réservée une fois à l'initialisation. Les instantanés sont pris et rendus
+ *          un par un (liste libre), ou tous ensemble en fin de décision avec snapshot_arena_reset().
+ *          Un pool n'est pas partagé entre threads : un pool par thread de recherche.
+ */
+
+#ifndef SNAPSHOT_ARENA_H
+#define SNAPSHOT_ARENA_H
+
+#include "model.h"
+
+typedef struct {
+    ModelSnapshot* slots;
+    int* free_list;     // Indices rendus, réutilisés en priorité
+    int capacity;
+    int used;           // Emplacements jamais distribués : [used, capacity)
+    int free_count;
+} SnapshotArena;
+
+int snapshot_arena_init(SnapshotArena* arena, int capacity);
+void snapshot_arena_destroy(SnapshotArena* arena);
+
+// NULL si le pool est plein
+ModelSnapshot* snapshot_arena_alloc(SnapshotArena* arena);
+void snapshot_arena_free(SnapshotArena* arena, ModelSnapshot* snap);
+
+// Rend tous les instantanés d'un coup (fin de décision)
+void snapshot_arena_reset(SnapshotArena* arena);
+
+// Nombre d'instantanés actuellement distribués
+int snapshot_arena_live(const SnapshotArena* arena);
+
+#endif
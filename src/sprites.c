@@ -0,0 +1,259 @@
+/**
+ * @file sprites.c
+ * @brief Bitmaps des sprites et de la police, et construction de l'atlas.
+ * @details Aucune dépendance SDL : partagé par le rendu, le packer d'assets et les outils.
+ */
+
+#include <string.h>
+#include <ctype.h>
+#include "sprites.h"
+
+// --- DONNÉES SPRITES (UNE RANGÉE PAR MOT, BIT DE POIDS FORT = COLONNE 0) ---
+
+static const uint32_t sprite_player[8] = {
+    0b00000100000,
+    0b00001110000,
+    0b00001110000,
+    0b01111111110,
+    0b11111111111,
+    0b11111111111,
+    0b10111011101,
+    0b10100000101
+};
+
+static const uint32_t sprite_enemy_1[8] = {
+    0b00100000100,
+    0b00010001000,
+    0b00111111100,
+    0b01101110110,
+    0b11111111111,
+    0b10111111101,
+    0b10100000101,
+    0b00011011000
+};
+static const uint32_t sprite_enemy_2[8] = {
+    0b00100000100,
+    0b10010001001,
+    0b10111111101,
+    0b11101110111,
+    0b11111111111,
+    0b01111111110,
+    0b00100000100,
+    0b01000000010
+};
+
+static const uint32_t sprite_ufo[7] = {
+    0b0000001111000000,
+    0b0001111111111000,
+    0b0011111111111100,
+    0b0110110110110110,
+    0b1111111111111111,
+    0b0011100110011100,
+    0b0001000000001000
+};
+
+static const uint32_t sprite_explosion[8] = {
+    0b10001010001,
+    0b01000100010,
+    0b00100000100,
+    0b00011111000,
+    0b10011011001,
+    0b00011111000,
+    0b01000100010,
+    0b10001010001
+};
+
+static const uint32_t sprite_shield_full[16] = {
+    0b0000111111111111110000,
+    0b0001111111111111111000,
+    0b0011111111111111111100,
+    0b0111111111111111111110,
+    0b1111111111111111111111,
+    0b1111111111111111111111,
+    0b1111111111111111111111,
+    0b1111111111111111111111,
+    0b1111111111111111111111,
+    0b1111111111111111111111,
+    0b1111111100000011111111,
+    0b1111111000000001111111,
+    0b1111110000000000111111,
+    0b1111100000000000011111,
+    0b1111000000000000001111,
+    0b1110000000000000000111
+};
+static const uint32_t sprite_shield_damaged[16] = {
+    0b0000111011111101110000,
+    0b0001111110110111111000,
+    0b0011111111111111011100,
+    0b0111011111001111111110,
+    0b1111111011111101111111,
+    0b1101111111111111101111,
+    0b1111110011111100111111,
+    0b1111111111001111111011,
+    0b1011101111111110111111,
+    0b1111111101111011110111,
+    0b1110111100000011111110,
+    0b1111111000000001101111,
+    0b1011110000000000111011,
+    0b1111100000000000011111,
+    0b1101000000000000001011,
+    0b1110000000000000000110
+};
+static const uint32_t sprite_shield_critical[16] = {
+    0b0000101000110001010000,
+    0b0000100100110010010000,
+    0b0010000000000000000100,
+    0b0100001000000010000010,
+    0b1000000000000000000001,
+    0b1001000000110000001001,
+    0b0100000000000000000010,
+    0b0010010000000000100100,
+    0b1000000000000000000001,
+    0b0000000100110010000000,
+    0b1010001000000001000101,
+    0b0100100000000000010010,
+    0b1000010000000000100001,
+    0b0010000000000000000100,
+    0b1001000000000000001001,
+    0b1010000000000000000101
+};
+
+// --- POLICE ---
+const unsigned char font_data[FONT_GLYPH_COUNT][FONT_GLYPH_SIZE] = {
+    {0b01110, 0b10001, 0b11111, 0b10001, 0b10001}, // A
+    {0b11110, 0b10001, 0b11110, 0b10001, 0b11110}, // B
+    {0b01110, 0b10001, 0b10000, 0b10001, 0b01110}, // C
+    {0b11110, 0b10001, 0b10001, 0b10001, 0b11110}, // D
+    {0b11111, 0b10000, 0b11110, 0b10000, 0b11111}, // E
+    {0b11111, 0b10000, 0b11110, 0b10000, 0b10000}, // F
+    {0b01111, 0b10000, 0b10111, 0b10001, 0b01110}, // G
+    {0b10001, 0b10001, 0b11111, 0b10001, 0b10001}, // H
+    {0b01110, 0b00100, 0b00100, 0b00100, 0b01110}, // I
+    {0b00111, 0b00010, 0b00010, 0b10010, 0b01100}, // J
+    {0b10001, 0b10010, 0b11100, 0b10010, 0b10001}, // K
+    {0b10000, 0b10000, 0b10000, 0b10000, 0b11111}, // L
+    {0b10001, 0b11011, 0b10101, 0b10001, 0b10001}, // M
+    {0b10001, 0b11001, 0b10101, 0b10011, 0b10001}, // N
+    {0b01110, 0b10001, 0b10001, 0b10001, 0b01110}, // O
+    {0b11110, 0b10001, 0b11110, 0b10000, 0b10000}, // P
+    {0b01110, 0b10001, 0b10001, 0b10010, 0b01101}, // Q
+    {0b11110, 0b10001, 0b11110, 0b10010, 0b10001}, // R
+    {0b01111, 0b10000, 0b01110, 0b00001, 0b11110}, // S
+    {0b11111, 0b00100, 0b00100, 0b00100, 0b00100}, // T
+    {0b10001, 0b10001, 0b10001, 0b10001, 0b01110}, // U
+    {0b10001, 0b10001, 0b10001, 0b01010, 0b00100}, // V
+    {0b10001, 0b10001, 0b10101, 0b11011, 0b10001}, // W
+    {0b10001, 0b01010, 0b00100, 0b01010, 0b10001}, // X
+    {0b10001, 0b10001, 0b01110, 0b00100, 0b00100}, // Y
+    {0b11111, 0b00010, 0b00100, 0b01000, 0b11111}, // Z
+    {0b00000, 0b00000, 0b00000, 0b00000, 0b00000}, // ESPACE
+    {0b01110, 0b10001, 0b10001, 0b10001, 0b01110}, // 0
+    {0b00100, 0b01100, 0b00100, 0b00100, 0b01110}, // 1
+    {0b01110, 0b10001, 0b00010, 0b00100, 0b11111}, // 2
+    {0b11110, 0b00001, 0b01110, 0b00001, 0b11110}, // 3
+    {0b00010, 0b00110, 0b01010, 0b11111, 0b00010}, // 4
+    {0b11111, 0b10000, 0b11110, 0b00001, 0b11110}, // 5
+    {0b01110, 0b10000, 0b11110, 0b10001, 0b01110}, // 6
+    {0b11111, 0b00001, 0b00010, 0b00100, 0b00100}, // 7
+    {0b01110, 0b10001, 0b01110, 0b10001, 0b01110}, // 8
+    {0b01110, 0b10001, 0b01111, 0b00001, 0b01110}, // 9
+    {0b00000, 0b00000, 0b11111, 0b00000, 0b00000}, // '-'
+    {0b00100, 0b00100, 0b11111, 0b00100, 0b00100}, // '+'
+    {0b00000, 0b00000, 0b00000, 0b00000, 0b00100}, // '.'
+    {0b00000, 0b00100, 0b00000, 0b00100, 0b00000}  // ':'
+};
+
+const SpriteDef sprite_defs[SPRITE_COUNT] = {
+    { sprite_player, SPRITE_PLAYER_W, SPRITE_PLAYER_H },
+    { sprite_enemy_1, SPRITE_ENEMY_W, SPRITE_ENEMY_H },
+    { sprite_enemy_2, SPRITE_ENEMY_W, SPRITE_ENEMY_H },
+    { sprite_ufo, SPRITE_UFO_W, SPRITE_UFO_H },
+    { sprite_explosion, SPRITE_EXPLOSION_W, SPRITE_EXPLOSION_H },
+    { sprite_shield_full, SPRITE_SHIELD_W, SPRITE_SHIELD_H },
+    { sprite_shield_damaged, SPRITE_SHIELD_W, SPRITE_SHIELD_H },
+    { sprite_shield_critical, SPRITE_SHIELD_W, SPRITE_SHIELD_H }
+};
+
+int sprite_pixel(const SpriteDef* sprite, int col, int row) { return (sprite->rows[row] >> (sprite->w - 1 - col)) & 1; }
+
+SpriteId sprite_shield_for_health(int health) {
+    if (health > 7) return SPRITE_SHIELD_FULL;
+    if (health > 3) return SPRITE_SHIELD_DAMAGED;
+    return SPRITE_SHIELD_CRITICAL;
+}
+
+int sprite_hit_rect(SpriteId id, float sx, float sy, float scale, float x, float y, float w, float h) {
+    const SpriteDef* s = &sprite_defs[id];
+    if (x >= sx + s->w * scale || x + w <= sx || y >= sy + s->h * scale || y + h <= sy) return 0;
+
+    // Colonnes et rangées de pixels touchées : la colonne c couvre [sx + c * scale, sx + (c + 1) * scale)
+    float u0 = (x - sx) / scale, u1 = (x + w - sx) / scale, v0 = (y - sy) / scale, v1 = (y + h - sy) / scale;
+    int c0 = u0 > 0 ? (int)u0 : 0, c1 = (int)u1 - ((float)(int)u1 == u1);
+    int r0 = v0 > 0 ? (int)v0 : 0, r1 = (int)v1 - ((float)(int)v1 == v1);
+    if (c1 >= s->w) c1 = s->w - 1;
+    if (r1 >= s->h) r1 = s->h - 1;
+    uint32_t mask = ((2u << (c1 - c0)) - 1) << (s->w - 1 - c1);
+    for (int r = r0; r <= r1; r++) if (s->rows[r] & mask) return 1;
+    return 0;
+}
+
+int font_glyph_index(char ch) {
+    char c = toupper((unsigned char)ch);
+    if (c >= 'A' && c <= 'Z') return c - 'A';
+    if (c >= '0' && c <= '9') return 27 + (c - '0');
+    if (c == '-') return 37;
+    if (c == '+') return 38;
+    if (c == '.') return 39;
+    if (c == ':') return 40;
+    return 26; // Espace (et caractères inconnus)
+}
+
+// --- ATLAS ---
+
+#define ATLAS_MAX_WIDTH 128
+#define ATLAS_PADDING 1
+
+/**
+ * @brief Place les entrées en étagères (ordre fixe) et calcule la taille de l'atlas.
+ */
+static void atlas_layout(AtlasHeader* h) {
+    int x = ATLAS_PADDING, y = ATLAS_PADDING, shelf_h = 0, width = 0;
+    for (int i = 0; i < ATLAS_ENTRY_COUNT; i++) {
+        int w = (i < SPRITE_COUNT) ? sprite_defs[i].w : FONT_GLYPH_SIZE;
+        int hh = (i < SPRITE_COUNT) ? sprite_defs[i].h : FONT_GLYPH_SIZE;
+        if (x + w + ATLAS_PADDING > ATLAS_MAX_WIDTH) { x = ATLAS_PADDING; y += shelf_h + ATLAS_PADDING; shelf_h = 0; }
+        h->rects[i].x = x; h->rects[i].y = y; h->rects[i].w = w; h->rects[i].h = hh;
+        x += w + ATLAS_PADDING;
+        if (hh > shelf_h) shelf_h = hh;
+        if (x > width) width = x;
+    }
+    h->width = width;
+    h->height = y + shelf_h + ATLAS_PADDING;
+    h->count = ATLAS_ENTRY_COUNT;
+    h->reserved = 0;
+}
+
+size_t sprites_atlas_size() {
+    AtlasHeader h;
+    atlas_layout(&h);
+    return sizeof(AtlasHeader) + (size_t)h.width * h.height;
+}
+
+void sprites_bake_atlas(void* out) {
+    AtlasHeader* h = (AtlasHeader*)out;
+    atlas_layout(h);
+    unsigned char* pixels = (unsigned char*)out + sizeof(AtlasHeader);
+    memset(pixels, 0, (size_t)h->width * h->height);
+
+    for (int i = 0; i < ATLAS_ENTRY_COUNT; i++) {
+        const AtlasRect* r = &h->rects[i];
+        for (int row = 0; row < r->h; row++) {
+            for (int col = 0; col < r->w; col++) {
+                int on;
+                if (i < SPRITE_COUNT) on = sprite_pixel(&sprite_defs[i], col, row);
+                else on = (font_data[i - SPRITE_COUNT][row] >> (FONT_GLYPH_SIZE - 1 - col)) & 1;
+                if (on) pixels[(r->y + row) * h->width + r->x + col] = 255;
+            }
+        }
+    }
+}
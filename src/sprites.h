@@ -0,0 +1,75 @@
+/**
+ * @file sprites.h
+ * @brief Sprites pixel art (rangées de bits), police 5x5, atlas pré-calculé et masques de collision.
+ * @details L'atlas (couverture 8 bits) est construit par le packer d'assets et stocké dans le bundle ;
+ *          à défaut il est reconstruit au lancement avec sprites_bake_atlas().
+ *          Chaque rangée d'un sprite est un mot de 32 bits (bit de poids fort = colonne 0) : les mêmes
+ *          données servent au rendu (atlas, rasteriseur) et aux collisions du modèle (sprite_hit_rect).
+ */
+
+#ifndef SPRITES_H
+#define SPRITES_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define SPRITE_PLAYER_W 11
+#define SPRITE_PLAYER_H 8
+#define SPRITE_ENEMY_W 11
+#define SPRITE_ENEMY_H 8
+#define SPRITE_UFO_W 16
+#define SPRITE_UFO_H 7
+#define SPRITE_EXPLOSION_W 11
+#define SPRITE_EXPLOSION_H 8
+#define SPRITE_SHIELD_W 22
+#define SPRITE_SHIELD_H 16
+
+#define FONT_GLYPH_COUNT 41
+#define FONT_GLYPH_SIZE 5
+
+typedef enum {
+    SPRITE_PLAYER,
+    SPRITE_ENEMY_1,
+    SPRITE_ENEMY_2,
+    SPRITE_UFO,
+    SPRITE_EXPLOSION,
+    SPRITE_SHIELD_FULL,
+    SPRITE_SHIELD_DAMAGED,
+    SPRITE_SHIELD_CRITICAL,
+    SPRITE_COUNT
+} SpriteId;
+
+typedef struct { const uint32_t* rows; int w, h; } SpriteDef; // w <= 32
+
+extern const SpriteDef sprite_defs[SPRITE_COUNT];
+extern const unsigned char font_data[FONT_GLYPH_COUNT][FONT_GLYPH_SIZE];
+
+int sprite_pixel(const SpriteDef* sprite, int col, int row);
+
+// Sprite de bouclier correspondant à ses points de vie (rendu et collisions)
+SpriteId sprite_shield_for_health(int health);
+
+/**
+ * @brief Collision au pixel près entre le rectangle (x, y, w, h) et le sprite dessiné en (sx, sy) à l'échelle `scale`.
+ * @details Boîte englobante d'abord ; en cas de recouvrement seulement, les colonnes couvertes deviennent un
+ *          masque (décalage) testé par ET sur les rangées couvertes.
+ */
+int sprite_hit_rect(SpriteId id, float sx, float sy, float scale, float x, float y, float w, float h);
+
+// Index du glyphe pour un caractère (lettres, chiffres, '-', '+', '.', ':', sinon espace)
+int font_glyph_index(char c);
+
+// --- ATLAS : en-tête suivi de width*height octets de couverture (0 ou 255) ---
+// Entrées : les SPRITE_COUNT sprites, puis les FONT_GLYPH_COUNT glyphes
+#define ATLAS_ENTRY_COUNT (SPRITE_COUNT + FONT_GLYPH_COUNT)
+
+typedef struct { int32_t x, y, w, h; } AtlasRect;
+typedef struct {
+    int32_t width, height, count, reserved;
+    AtlasRect rects[ATLAS_ENTRY_COUNT];
+} AtlasHeader;
+
+size_t sprites_atlas_size();
+void sprites_bake_atlas(void* out);
+
+#endif
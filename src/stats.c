@@ -0,0 +1,86 @@
+/**
+ * @file stats.c
+ * @brief Implémentation des esquisses de quantiles (seaux logarithmiques) et des histogrammes.
+ */
+
+#include <string.h>
+#include <math.h>
+#include "stats.h"
+
+// gamma = (1 + a) / (1 - a) : le seau i couvre ]gamma^(i-1), gamma^i], son représentant est à a près
+#define SKETCH_GAMMA ((1.0 + STATS_SKETCH_ERROR) / (1.0 - STATS_SKETCH_ERROR))
+
+void stats_sketch_init(QuantileSketch* s) {
+    memset(s, 0, sizeof(*s));
+    s->min = INFINITY;
+    s->max = -INFINITY;
+}
+
+static int bucket_index(double value) {
+    int i = (int)ceil(log(value) / log(SKETCH_GAMMA));
+    if (i < 0) i = 0;
+    if (i >= STATS_SKETCH_BUCKETS) i = STATS_SKETCH_BUCKETS - 1;
+    return i;
+}
+
+static double bucket_value(int i) {
+    return 2.0 * pow(SKETCH_GAMMA, i) / (SKETCH_GAMMA + 1.0);
+}
+
+void stats_sketch_add(QuantileSketch* s, double value) {
+    s->count++;
+    s->sum += value;
+    if (value < s->min) s->min = value;
+    if (value > s->max) s->max = value;
+    if (value <= 0) s->zeros++;
+    else s->buckets[bucket_index(value)]++;
+}
+
+void stats_sketch_merge(QuantileSketch* into, const QuantileSketch* from) {
+    into->count += from->count;
+    into->zeros += from->zeros;
+    into->sum += from->sum;
+    if (from->min < into->min) into->min = from->min;
+    if (from->max > into->max) into->max = from->max;
+    for (int i = 0; i < STATS_SKETCH_BUCKETS; i++) into->buckets[i] += from->buckets[i];
+}
+
+double stats_sketch_quantile(const QuantileSketch* s, double q) {
+    if (s->count == 0) return 0;
+    uint64_t rank = (uint64_t)(q * (s->count - 1));
+    if (rank < s->zeros) return s->min < 0 ? s->min : 0;
+    uint64_t seen = s->zeros;
+    for (int i = 0; i < STATS_SKETCH_BUCKETS; i++) {
+        seen += s->buckets[i];
+        if (seen > rank) {
+            double v = bucket_value(i);
+            return v < s->min ? s->min : (v > s->max ? s->max : v);
+        }
+    }
+    return s->max;
+}
+
+double stats_sketch_mean(const QuantileSketch* s) {
+    return s->count ? s->sum / s->count : 0;
+}
+
+void stats_sketch_histogram(const QuantileSketch* s, uint64_t* out, int bins) {
+    memset(out, 0, bins * sizeof(uint64_t));
+    if (s->count == 0) return;
+    double lo = s->min < 0 ? s->min : 0, width = (s->max - lo) / bins;
+    if (width <= 0) { out[0] = s->count; return; }
+    out[0] += s->zeros;
+    for (int i = 0; i < STATS_SKETCH_BUCKETS; i++) {
+        if (!s->buckets[i]) continue;
+        int b = (int)((bucket_value(i) - lo) / width);
+        out[b < 0 ? 0 : (b >= bins ? bins - 1 : b)] += s->buckets[i];
+    }
+}
+
+void stats_histogram_add(Histogram* h, int value) {
+    h->bins[value < 0 ? 0 : (value >= STATS_HISTOGRAM_BINS ? STATS_HISTOGRAM_BINS - 1 : value)]++;
+}
+
+void stats_histogram_merge(Histogram* into, const Histogram* from) {
+    for (int i = 0; i < STATS_HISTOGRAM_BINS; i++) into->bins[i] += from->bins[i];
+}
@@ -0,0 +1,46 @@
+/**
+ * @file stats.h
+ * @brief Statistiques en flux pour les études headless : esquisse de quantiles et histogramme fusionnables.
+ * @details L'esquisse range chaque valeur positive dans un seau logarithmique de largeur relative
+ *          STATS_SKETCH_ERROR (le principe de DDSketch) : tout quantile est exact à 1 % près, quelle que
+ *          soit l'étendue des valeurs, avec une mémoire fixe. Deux esquisses (ou deux histogrammes)
+ *          se fusionnent en additionnant leurs compteurs : un exemplaire par thread, fusionnés à la fin.
+ */
+
+#ifndef STATS_H
+#define STATS_H
+
+#include <stdint.h>
+
+#define STATS_SKETCH_ERROR 0.01
+#define STATS_SKETCH_BUCKETS 1100   // Valeurs jusqu'à ~2^31 avec une erreur relative de 1 %
+#define STATS_HISTOGRAM_BINS 64
+
+typedef struct {
+    uint64_t count;
+    uint64_t zeros;                 // Valeurs <= 0 (regroupées)
+    uint64_t buckets[STATS_SKETCH_BUCKETS];
+    double sum;
+    double min, max;
+} QuantileSketch;
+
+/**
+ * @brief Histogramme exact de petites valeurs entières (niveaux, causes...), la dernière case déborde.
+ */
+typedef struct {
+    uint64_t bins[STATS_HISTOGRAM_BINS];
+} Histogram;
+
+void stats_sketch_init(QuantileSketch* s);
+void stats_sketch_add(QuantileSketch* s, double value);
+void stats_sketch_merge(QuantileSketch* into, const QuantileSketch* from);
+double stats_sketch_quantile(const QuantileSketch* s, double q); // q dans [0, 1]
+double stats_sketch_mean(const QuantileSketch* s);
+
+// Répartit l'esquisse en bins intervalles égaux entre min et max (histogramme du rapport)
+void stats_sketch_histogram(const QuantileSketch* s, uint64_t* out, int bins);
+
+void stats_histogram_add(Histogram* h, int value);
+void stats_histogram_merge(Histogram* into, const Histogram* from);
+
+#endif
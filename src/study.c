@@ -0,0 +1,448 @@
+/**
+ * @file study.c
+ * @brief Implémentation de l'étude headless (threads SDL, statistiques par thread fusionnées à la fin).
+ * @details Les threads réservent des paquets de STUDY_CHUNK parties par un compteur atomique ; le thread
+ *          principal affiche l'avancement (parties/s) chaque seconde. Cause de fin de partie : "tir ennemi"
+ *          si le joueur a été touché au dernier tick, "invasion" sinon (formation arrivée en bas),
+ *          "limite" si la partie dure STUDY_MAX_TICKS ticks.
+ */
+
+#include <SDL3/SDL.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h>
+#include <math.h>
+#include "study.h"
+#include "stats.h"
+#include "model.h"
+#include "replay.h"
+
+#define STUDY_MAX_THREADS 64
+#define STUDY_CHUNK 16             // Parties réservées d'un coup par un thread
+#define STUDY_RANDOM_PERCENT 30    // Part de coups aléatoires de la politique
+#define STUDY_DODGE_DISTANCE 40    // Hauteur au-dessus du joueur où un tir ennemi est esquivé
+#define STUDY_REPORT_BINS 20
+
+typedef enum { DEATH_SHOT, DEATH_INVASION, DEATH_LIMIT, DEATH_CAUSES } DeathCause;
+
+static const char* death_names[DEATH_CAUSES] = { "tir_ennemi", "invasion", "limite" };
+
+typedef struct {
+    const char* name;
+    size_t offset;             // Champ de GameRules
+    enum { RULE_FLOAT, RULE_INT, RULE_SEED } kind;
+} RuleField;
+
+static const RuleField rule_fields[] = {
+    { "enemy_speed", offsetof(GameRules, enemy_speed), RULE_FLOAT },
+    { "projectile_speed", offsetof(GameRules, projectile_speed), RULE_FLOAT },
+    { "enemy_shot_chance", offsetof(GameRules, enemy_shot_chance), RULE_INT },
+    { "ufo_chance", offsetof(GameRules, ufo_chance), RULE_INT },
+    { "formation_drop", offsetof(GameRules, formation_drop), RULE_FLOAT },
+    { "wave_seed", offsetof(GameRules, wave_seed), RULE_SEED }, // 0 : table des niveaux
+};
+#define RULE_FIELDS (int)(sizeof(rule_fields) / sizeof(rule_fields[0]))
+
+typedef struct {
+    QuantileSketch score;
+    QuantileSketch survival;   // Ticks joués
+    Histogram level;           // Niveau atteint
+    uint64_t deaths[DEATH_CAUSES];
+    uint64_t games;
+    uint64_t ticks;
+} StudyStats;
+
+typedef struct {
+    long games;                // Parties par configuration
+    uint64_t seed;
+    const GameRules* configs;  // Une étude simple n'a qu'une configuration
+    int config_count;
+    StudyStats* results;       // Une entrée par configuration
+    SDL_Mutex* lock;           // Protège results
+    SDL_AtomicInt next_chunk;  // 32 bits : le total est borné par STUDY_MAX_GAMES
+    SDL_AtomicInt done;        // Parties terminées (affichage de l'avancement)
+} StudyJob;
+
+typedef struct {
+    StudyJob* job;
+    SDL_Thread* thread;
+    StudyStats stats;          // Statistiques locales de la configuration en cours
+} StudyWorker;
+
+static uint32_t policy_random(uint64_t* rng) {
+    uint64_t x = *rng;
+    x ^= x >> 12; x ^= x << 25; x ^= x >> 27;
+    *rng = x;
+    return (uint32_t)((x * 0x2545F4914F6CDD1Dull) >> 32);
+}
+
+/**
+ * @brief Politique scriptée : esquive le tir ennemi le plus proche, sinon vise l'ennemi vivant le plus
+ *        proche horizontalement et tire une fois aligné. Son aléa lui est propre (l'état du jeu n'est pas touché).
+ */
+static InputType study_policy(const GameState* s, uint64_t* rng) {
+    if (policy_random(rng) % 100 < STUDY_RANDOM_PERCENT) return (InputType)(INPUT_NONE + policy_random(rng) % 4);
+
+    float center = s->pos.x + PLAYER_W / 2.0f;
+    for (int i = 0; i < MAX_ENEMY_SHOTS; i++) {
+        const Shot* shot = &s->enemy_shots[i];
+        if (!shot->active || shot->pos.y < s->pos.y - STUDY_DODGE_DISTANCE || shot->pos.y > s->pos.y + PLAYER_H) continue;
+        if (shot->pos.x < s->pos.x - 10 || shot->pos.x > s->pos.x + PLAYER_W + 10) continue;
+        if (shot->pos.x < center) return s->pos.x + PLAYER_W < GAME_WIDTH - s->settings.player_speed ? INPUT_RIGHT : INPUT_LEFT;
+        return s->pos.x > s->settings.player_speed ? INPUT_LEFT : INPUT_RIGHT;
+    }
+
+    float best = GAME_WIDTH * 2;
+    float target = center;
+    for (int i = 0; i < s->enemy_count; i++) {
+        if (!s->enemies[i].alive) continue;
+        float x = s->enemies[i].pos.x + ENEMY_W / 2.0f;
+        float d = x > center ? x - center : center - x;
+        if (d < best) { best = d; target = x; }
+    }
+    if (target < center - s->settings.player_speed) return INPUT_LEFT;
+    if (target > center + s->settings.player_speed) return INPUT_RIGHT;
+    return INPUT_SHOOT;
+}
+
+static void study_stats_init(StudyStats* st) {
+    memset(st, 0, sizeof(*st));
+    stats_sketch_init(&st->score);
+    stats_sketch_init(&st->survival);
+}
+
+static void study_stats_merge(StudyStats* into, const StudyStats* from) {
+    stats_sketch_merge(&into->score, &from->score);
+    stats_sketch_merge(&into->survival, &from->survival);
+    stats_histogram_merge(&into->level, &from->level);
+    for (int i = 0; i < DEATH_CAUSES; i++) into->deaths[i] += from->deaths[i];
+    into->games += from->games;
+    into->ticks += from->ticks;
+}
+
+static void play_game(StudyStats* st, const GameRules* rules, uint64_t seed) {
+    GameState state = {0};
+    model_new_game(&state, rules);
+    replay_start_state(&state, seed, state.settings.player_speed);
+    uint64_t rng = seed * 0x9E3779B97F4A7C15ull | 1;
+    int ticks = 0, hit = 0;
+    while (!state.game_over && ticks < STUDY_MAX_TICKS) {
+        replay_apply_input(&state, study_policy(&state, &rng));
+        model_tick(&state);
+        hit = 0;
+        for (int e = 0; e < state.event_count; e++) hit |= state.events[e].type == EVENT_PLAYER_HIT;
+        model_clear_events(&state);
+        ticks++;
+    }
+    stats_sketch_add(&st->score, state.score);
+    stats_sketch_add(&st->survival, ticks);
+    stats_histogram_add(&st->level, state.level);
+    st->deaths[!state.game_over ? DEATH_LIMIT : (hit ? DEATH_SHOT : DEATH_INVASION)]++;
+    st->games++;
+    st->ticks += ticks;
+}
+
+/**
+ * @brief Reverse les statistiques locales d'un thread dans celles de leur configuration.
+ */
+static void flush_stats(StudyWorker* w, int config) {
+    SDL_LockMutex(w->job->lock);
+    study_stats_merge(&w->job->results[config], &w->stats);
+    SDL_UnlockMutex(w->job->lock);
+    study_stats_init(&w->stats);
+}
+
+static int SDLCALL study_worker(void* data) {
+    StudyWorker* w = (StudyWorker*)data;
+    StudyJob* job = w->job;
+    long chunks_per_config = (job->games + STUDY_CHUNK - 1) / STUDY_CHUNK;
+    long chunk;
+    int current = -1;
+    while ((chunk = SDL_AddAtomicInt(&job->next_chunk, 1)) < chunks_per_config * job->config_count) {
+        int config = (int)(chunk / chunks_per_config);
+        if (config != current && current >= 0) flush_stats(w, current); // Une étude simple ne fusionne qu'à la fin
+        current = config;
+        long first = chunk % chunks_per_config * STUDY_CHUNK, last = first + STUDY_CHUNK < job->games ? first + STUDY_CHUNK : job->games;
+        for (long g = first; g < last; g++) play_game(&w->stats, &job->configs[config], job->seed + g);
+        SDL_AddAtomicInt(&job->done, (int)(last - first));
+    }
+    if (current >= 0) flush_stats(w, current);
+    return 0;
+}
+
+/**
+ * @brief Répartit le travail sur les threads, affiche l'avancement chaque seconde ; renvoie la durée en secondes.
+ */
+static double run_job(StudyJob* job, int threads) {
+    long total = job->games * job->config_count;
+    StudyWorker* workers = calloc(threads, sizeof(StudyWorker));
+    job->lock = SDL_CreateMutex();
+    if (!workers || !job->lock) { free(workers); SDL_DestroyMutex(job->lock); return -1; }
+    Uint64 start = SDL_GetPerformanceCounter(), freq = SDL_GetPerformanceFrequency();
+    int started = 0;
+    for (int i = 0; i < threads; i++) {
+        workers[i].job = job;
+        study_stats_init(&workers[i].stats);
+        workers[i].thread = SDL_CreateThread(study_worker, "study", &workers[i]);
+        if (!workers[i].thread) { printf(" Warning: thread d'étude impossible : %s\n", SDL_GetError()); break; }
+        started++;
+    }
+    if (started == 0) study_worker(&workers[0]); // Pas de thread : le thread principal joue tout
+
+    // Avancement chaque seconde, pendant que les threads jouent
+    Uint64 last_print = start;
+    while (started > 0 && SDL_GetAtomicInt(&job->done) < total) {
+        SDL_Delay(50);
+        Uint64 now = SDL_GetPerformanceCounter();
+        if (now - last_print < freq) continue;
+        last_print = now;
+        int done = SDL_GetAtomicInt(&job->done);
+        printf("  %d / %ld parties (%.0f parties/s)\n", done, total, done / ((now - start) / (double)freq));
+        fflush(stdout);
+    }
+    for (int i = 0; i < threads; i++) if (workers[i].thread) SDL_WaitThread(workers[i].thread, NULL);
+    free(workers);
+    SDL_DestroyMutex(job->lock);
+    return (SDL_GetPerformanceCounter() - start) / (double)freq;
+}
+
+static const double report_quantiles[] = { 0.01, 0.05, 0.10, 0.25, 0.50, 0.75, 0.90, 0.95, 0.99 };
+#define REPORT_QUANTILES (int)(sizeof(report_quantiles) / sizeof(report_quantiles[0]))
+
+static void write_sketch_json(FILE* f, const char* name, const QuantileSketch* s) {
+    uint64_t bins[STUDY_REPORT_BINS];
+    stats_sketch_histogram(s, bins, STUDY_REPORT_BINS);
+    fprintf(f, "  \"%s\": {\"mean\": %.2f, \"min\": %.0f, \"max\": %.0f, \"quantiles\": {", name,
+            stats_sketch_mean(s), s->count ? s->min : 0, s->count ? s->max : 0);
+    for (int i = 0; i < REPORT_QUANTILES; i++)
+        fprintf(f, "%s\"p%02.0f\": %.0f", i ? ", " : "", report_quantiles[i] * 100, stats_sketch_quantile(s, report_quantiles[i]));
+    fprintf(f, "}, \"histogram\": [");
+    for (int i = 0; i < STUDY_REPORT_BINS; i++) fprintf(f, "%s%llu", i ? ", " : "", (unsigned long long)bins[i]);
+    fprintf(f, "]},\n");
+}
+
+static void write_sketch_csv(FILE* f, const char* name, const QuantileSketch* s) {
+    uint64_t bins[STUDY_REPORT_BINS];
+    stats_sketch_histogram(s, bins, STUDY_REPORT_BINS);
+    fprintf(f, "%s,mean,%.2f\n%s,min,%.0f\n%s,max,%.0f\n", name, stats_sketch_mean(s), name, s->count ? s->min : 0,
+            name, s->count ? s->max : 0);
+    for (int i = 0; i < REPORT_QUANTILES; i++)
+        fprintf(f, "%s,p%02.0f,%.0f\n", name, report_quantiles[i] * 100, stats_sketch_quantile(s, report_quantiles[i]));
+    for (int i = 0; i < STUDY_REPORT_BINS; i++) fprintf(f, "%s,bin%02d,%llu\n", name, i, (unsigned long long)bins[i]);
+}
+
+static int write_report(const char* path, const StudyStats* st, uint64_t seed, int threads, double seconds) {
+    FILE* f = fopen(path, "w");
+    if (!f) return 0;
+    size_t n = strlen(path);
+    double rate = seconds > 0 ? st->games / seconds : 0;
+    int max_level = 0;
+    for (int i = 0; i < STATS_HISTOGRAM_BINS; i++) if (st->level.bins[i]) max_level = i;
+
+    if (n >= 4 && strcmp(path + n - 4, ".csv") == 0) {
+        fprintf(f, "metric,stat,value\n");
+        fprintf(f, "study,games,%llu\nstudy,seed,%llu\nstudy,threads,%d\nstudy,seconds,%.3f\nstudy,games_per_second,%.1f\n",
+                (unsigned long long)st->games, (unsigned long long)seed, threads, seconds, rate);
+        write_sketch_csv(f, "score", &st->score);
+        write_sketch_csv(f, "survival_ticks", &st->survival);
+        for (int i = 1; i <= max_level; i++) fprintf(f, "level,%d,%llu\n", i, (unsigned long long)st->level.bins[i]);
+        for (int i = 0; i < DEATH_CAUSES; i++) fprintf(f, "death_cause,%s,%llu\n", death_names[i], (unsigned long long)st->deaths[i]);
+    } else {
+        fprintf(f, "{\n  \"games\": %llu,\n  \"seed\": %llu,\n  \"threads\": %d,\n  \"seconds\": %.3f,\n  \"games_per_second\": %.1f,\n",
+                (unsigned long long)st->games, (unsigned long long)seed, threads, seconds, rate);
+        write_sketch_json(f, "score", &st->score);
+        write_sketch_json(f, "survival_ticks", &st->survival);
+        fprintf(f, "  \"level\": {");
+        for (int i = 1; i <= max_level; i++) fprintf(f, "%s\"%d\": %llu", i > 1 ? ", " : "", i, (unsigned long long)st->level.bins[i]);
+        fprintf(f, "},\n  \"death_cause\": {");
+        for (int i = 0; i < DEATH_CAUSES; i++) fprintf(f, "%s\"%s\": %llu", i ? ", " : "", death_names[i], (unsigned long long)st->deaths[i]);
+        fprintf(f, "}\n}\n");
+    }
+    return fclose(f) == 0;
+}
+
+int study_run(long games, int threads, uint64_t seed, const char* out_path) {
+    if (threads < 1) threads = 1;
+    if (threads > STUDY_MAX_THREADS) threads = STUDY_MAX_THREADS;
+    if (games < 0) games = 0;
+    if (games > STUDY_MAX_GAMES) { printf("Trop de parties (%ld au plus)\n", STUDY_MAX_GAMES); return 0; }
+    printf("--- Étude : %ld parties, %d threads, graines %llu+ ---\n", games, threads, (unsigned long long)seed);
+
+    GameRules rules;
+    model_default_rules(&rules);
+    StudyStats total;
+    study_stats_init(&total);
+    StudyJob job = { games, seed, &rules, 1, &total, NULL, {0}, {0} };
+    double seconds = run_job(&job, threads);
+    if (seconds < 0) return 0;
+
+    printf("%llu parties en %.2f s (%.0f parties/s, %.2f M ticks/s)\n", (unsigned long long)total.games, seconds,
+           seconds > 0 ? total.games / seconds : 0.0, seconds > 0 ? total.ticks / seconds / 1e6 : 0.0);
+    printf("Score : moyenne %.1f, médiane %.0f, p90 %.0f, p99 %.0f, max %.0f\n", stats_sketch_mean(&total.score),
+           stats_sketch_quantile(&total.score, 0.5), stats_sketch_quantile(&total.score, 0.9),
+           stats_sketch_quantile(&total.score, 0.99), total.score.count ? total.score.max : 0);
+    printf("Survie : médiane %.0f ticks, p90 %.0f ticks\n", stats_sketch_quantile(&total.survival, 0.5),
+           stats_sketch_quantile(&total.survival, 0.9));
+    printf("Fin de partie :");
+    for (int i = 0; i < DEATH_CAUSES; i++) printf(" %s %llu%s", death_names[i], (unsigned long long)total.deaths[i], i + 1 < DEATH_CAUSES ? "," : "\n");
+
+    if (!write_report(out_path, &total, seed, threads, seconds)) { printf("Impossible d'écrire le rapport %s\n", out_path); return 0; }
+    printf("Rapport : %s\n", out_path);
+    return 1;
+}
+
+// --- BALAYAGE DE RÈGLES ---
+
+typedef struct {
+    int field;                 // Indice dans rule_fields
+    int count;
+    double values[STUDY_MAX_RULE_VALUES];
+} RuleAxis;
+
+static void set_rule(GameRules* rules, int field, double value) {
+    char* p = (char*)rules + rule_fields[field].offset;
+    switch (rule_fields[field].kind) {
+        case RULE_INT: *(int*)p = (int)lround(value); break;
+        case RULE_SEED: *(uint64_t*)p = value > 0 ? (uint64_t)llround(value) : 0; break;
+        default: *(float*)p = (float)value; break;
+    }
+}
+
+static double get_rule(const GameRules* rules, int field) {
+    const char* p = (const char*)rules + rule_fields[field].offset;
+    switch (rule_fields[field].kind) {
+        case RULE_INT: return *(const int*)p;
+        case RULE_SEED: return (double)*(const uint64_t*)p;
+        default: return *(const float*)p;
+    }
+}
+
+/**
+ * @brief Lit "nom=v1,v2,..." ou "nom=début:fin:pas" ; 0 si la spécification est invalide.
+ * @details Les valeurs négatives sont refusées : une formation ou des tirs à reculons ne rebondissent
+ *          plus sur les bords (détection selon la direction) et sortiraient de l'écran.
+ */
+static int parse_axis(const char* spec, RuleAxis* axis) {
+    const char* eq = strchr(spec, '=');
+    if (!eq) return 0;
+    axis->field = -1;
+    for (int i = 0; i < RULE_FIELDS; i++)
+        if (strlen(rule_fields[i].name) == (size_t)(eq - spec) && strncmp(spec, rule_fields[i].name, eq - spec) == 0) axis->field = i;
+    if (axis->field < 0) return 0;
+
+    double from, to, step;
+    char tail;
+    axis->count = 0;
+    if (sscanf(eq + 1, "%lf:%lf:%lf%c", &from, &to, &step, &tail) == 3) {
+        if (step <= 0 || to < from) return 0;
+        for (double v = from; v <= to + step * 1e-6 && axis->count < STUDY_MAX_RULE_VALUES; v = from + step * axis->count)
+            axis->values[axis->count++] = v;
+        return from >= 0;
+    }
+    const char* p = eq + 1;
+    while (*p && axis->count < STUDY_MAX_RULE_VALUES) {
+        char* end;
+        axis->values[axis->count++] = strtod(p, &end);
+        if (end == p || (*end && *end != ',') || axis->values[axis->count - 1] < 0) return 0;
+        p = *end ? end + 1 : end;
+    }
+    return axis->count > 0;
+}
+
+static int write_sweep(const char* path, const GameRules* configs, const StudyStats* results, int config_count) {
+    FILE* f = fopen(path, "w");
+    if (!f) return 0;
+    fprintf(f, "config");
+    for (int i = 0; i < RULE_FIELDS; i++) fprintf(f, ",%s", rule_fields[i].name);
+    fprintf(f, ",games,score_mean,score_p10,score_p50,score_p90,survival_mean,survival_p10,survival_p50,level_mean");
+    for (int i = 0; i < DEATH_CAUSES; i++) fprintf(f, ",%s", death_names[i]);
+    fprintf(f, "\n");
+    for (int c = 0; c < config_count; c++) {
+        const StudyStats* st = &results[c];
+        double level_sum = 0;
+        for (int i = 0; i < STATS_HISTOGRAM_BINS; i++) level_sum += (double)i * st->level.bins[i];
+        fprintf(f, "%d", c);
+        for (int i = 0; i < RULE_FIELDS; i++) fprintf(f, ",%g", get_rule(&configs[c], i));
+        fprintf(f, ",%llu,%.1f,%.0f,%.0f,%.0f,%.1f,%.0f,%.0f,%.2f", (unsigned long long)st->games, stats_sketch_mean(&st->score),
+                stats_sketch_quantile(&st->score, 0.1), stats_sketch_quantile(&st->score, 0.5), stats_sketch_quantile(&st->score, 0.9),
+                stats_sketch_mean(&st->survival), stats_sketch_quantile(&st->survival, 0.1), stats_sketch_quantile(&st->survival, 0.5),
+                st->games ? level_sum / st->games : 0.0);
+        for (int i = 0; i < DEATH_CAUSES; i++) fprintf(f, ",%.4f", st->games ? (double)st->deaths[i] / st->games : 0.0);
+        fprintf(f, "\n");
+    }
+    return fclose(f) == 0;
+}
+
+int study_sweep(long games, int threads, uint64_t seed, const char** rules, int rule_count, int samples, const char* out_path) {
+    if (threads < 1) threads = 1;
+    if (threads > STUDY_MAX_THREADS) threads = STUDY_MAX_THREADS;
+    if (games < 1) games = 1;
+
+    RuleAxis* axes = calloc(rule_count > 0 ? rule_count : 1, sizeof(RuleAxis));
+    if (!axes) return 0;
+    long grid = 1;
+    for (int i = 0; i < rule_count; i++) {
+        if (!parse_axis(rules[i], &axes[i])) {
+            printf("Règle invalide : %s (attendu nom=v1,v2,... ou nom=début:fin:pas, valeurs positives ou nulles ; noms :", rules[i]);
+            for (int k = 0; k < RULE_FIELDS; k++) printf(" %s", rule_fields[k].name);
+            printf(")\n");
+            free(axes);
+            return 0;
+        }
+        grid = grid * axes[i].count > STUDY_MAX_CONFIGS ? STUDY_MAX_CONFIGS + 1 : grid * axes[i].count;
+    }
+    int config_count = samples > 0 ? samples : (int)grid;
+    if (config_count > STUDY_MAX_CONFIGS) {
+        printf("Trop de configurations (%s%d au plus) : utiliser --sample\n", samples > 0 ? "" : "grille de ", STUDY_MAX_CONFIGS);
+        free(axes);
+        return 0;
+    }
+    if (games > STUDY_MAX_GAMES / config_count) {
+        printf("Trop de parties : %ld x %d configurations (%ld au plus)\n", games, config_count, STUDY_MAX_GAMES);
+        free(axes);
+        return 0;
+    }
+
+    GameRules* configs = malloc(config_count * sizeof(GameRules));
+    StudyStats* results = malloc(config_count * sizeof(StudyStats));
+    if (!configs || !results) { free(axes); free(configs); free(results); return 0; }
+    uint64_t rng = seed * 0x9E3779B97F4A7C15ull | 1;
+    for (int c = 0; c < config_count; c++) {
+        model_default_rules(&configs[c]);
+        study_stats_init(&results[c]);
+        long index = c; // Grille : indice en base mixte, la dernière règle varie le plus vite
+        for (int i = rule_count - 1; i >= 0; i--) {
+            const RuleAxis* a = &axes[i];
+            double v;
+            if (samples > 0) {
+                double lo = a->values[0], hi = a->values[0];
+                for (int k = 1; k < a->count; k++) { if (a->values[k] < lo) lo = a->values[k]; if (a->values[k] > hi) hi = a->values[k]; }
+                v = lo + (hi - lo) * (policy_random(&rng) / 4294967296.0);
+            } else {
+                v = a->values[index % a->count];
+                index /= a->count;
+            }
+            set_rule(&configs[c], a->field, v);
+        }
+    }
+    free(axes);
+
+    printf("--- Balayage : %d configurations x %ld parties, %d threads, graines %llu+ ---\n", config_count, games, threads,
+           (unsigned long long)seed);
+    StudyJob job = { games, seed, configs, config_count, results, NULL, {0}, {0} };
+    double seconds = run_job(&job, threads);
+    int ok = seconds >= 0;
+    if (ok) {
+        int best = 0;
+        for (int c = 1; c < config_count; c++) if (stats_sketch_mean(&results[c].score) > stats_sketch_mean(&results[best].score)) best = c;
+        printf("%ld parties en %.2f s (%.0f parties/s)\n", games * config_count, seconds, seconds > 0 ? games * config_count / seconds : 0.0);
+        printf("Meilleur score moyen : configuration %d (%.1f)\n", best, stats_sketch_mean(&results[best].score));
+        ok = write_sweep(out_path, configs, results, config_count);
+        if (ok) printf("Rapport : %s\n", out_path);
+        else printf("Impossible d'écrire le rapport %s\n", out_path);
+    }
+    free(configs);
+    free(results);
+    return ok;
+}
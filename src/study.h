@@ -0,0 +1,39 @@
+/**
+ * @file study.h
+ * @brief Étude headless (options --study, --sweep) : des millions de parties simulées, distributions agrégées en flux.
+ * @details Chaque thread joue ses graines avec une politique scriptée bon marché (viser, tirer, esquiver,
+ *          avec une part d'aléatoire) et accumule ses propres esquisses et histogrammes ; aucun résultat
+ *          de partie n'est conservé. Les statistiques des threads sont fusionnées à la fin.
+ *          Le balayage applique la même étude à une grille (ou un échantillon aléatoire) de GameRules :
+ *          toutes les configurations jouent les mêmes graines, leurs écarts ne viennent que des règles.
+ */
+
+#ifndef STUDY_H
+#define STUDY_H
+
+#include <stdint.h>
+
+#define STUDY_MAX_TICKS 18000 // 5 minutes de jeu : au-delà, la partie compte comme survie ("limite")
+#define STUDY_MAX_RULE_VALUES 256
+#define STUDY_MAX_CONFIGS 4096     // Environ 18 Ko de statistiques par configuration
+#define STUDY_MAX_GAMES 2000000000L // Parties au total (toutes configurations) : compteurs atomiques de 32 bits
+
+/**
+ * @brief Joue `games` parties (graines seed, seed+1...) sur `threads` threads et écrit le rapport.
+ * @param out_path Rapport JSON, ou CSV si le nom se termine par .csv.
+ * @return 1 si succès, 0 si games dépasse STUDY_MAX_GAMES ou si le rapport n'a pas pu être écrit.
+ */
+int study_run(long games, int threads, uint64_t seed, const char* out_path);
+
+/**
+ * @brief Balayage de règles : `games` parties par configuration, rapport CSV d'une ligne par configuration.
+ * @param rules Spécifications "nom=v1,v2,..." ou "nom=début:fin:pas", nom d'un champ de GameRules ;
+ *              les règles non citées gardent leur valeur par défaut.
+ * @param samples 0 pour la grille complète (produit cartésien), K > 0 pour K configurations tirées
+ *                uniformément entre la plus petite et la plus grande valeur de chaque règle.
+ * @return 1 si succès, 0 si une spécification est invalide, si le total de parties dépasse STUDY_MAX_GAMES
+ *         ou si le rapport n'a pas pu être écrit.
+ */
+int study_sweep(long games, int threads, uint64_t seed, const char** rules, int rule_count, int samples, const char* out_path);
+
+#endif
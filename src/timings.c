@@ -0,0 +1,47 @@
+/**
+ * @file timings.c
+ * @brief Implémentation du chronométrage des phases de démarrage.
+ * @details Utilise le compteur haute résolution SDL (disponible sans SDL_Init).
+ */
+
+#include <SDL3/SDL.h>
+#include <stdio.h>
+#include "timings.h"
+
+#define MAX_PHASES 16
+
+typedef struct { const char* name; Uint64 ticks; } Phase;
+
+static int is_enabled = 0;
+static Uint64 start_ticks = 0;
+static Uint64 last_ticks = 0;
+static Phase phases[MAX_PHASES];
+static int phase_count = 0;
+
+void timings_enable(int enabled) {
+    is_enabled = enabled;
+    start_ticks = last_ticks = SDL_GetPerformanceCounter();
+    phase_count = 0;
+}
+
+int timings_enabled() { return is_enabled; }
+
+void timings_mark(const char* phase) {
+    if (!is_enabled || phase_count >= MAX_PHASES) return;
+    Uint64 now = SDL_GetPerformanceCounter();
+    phases[phase_count].name = phase;
+    phases[phase_count].ticks = now - last_ticks;
+    phase_count++;
+    last_ticks = now;
+}
+
+void timings_report() {
+    if (!is_enabled || phase_count == 0) return;
+    double freq = (double)SDL_GetPerformanceFrequency();
+    printf("--- Temps de démarrage ---\n");
+    for (int i = 0; i < phase_count; i++) {
+        printf("  %-24s %8.3f ms\n", phases[i].name, phases[i].ticks * 1000.0 / freq);
+    }
+    printf("  %-24s %8.3f ms\n", "TOTAL", (last_ticks - start_ticks) * 1000.0 / freq);
+    phase_count = 0;
+}
@@ -0,0 +1,15 @@
+/**
+ * @file timings.h
+ * @brief Chronométrage des phases de démarrage (option --timings).
+ * @details Chaque appel à timings_mark() enregistre la durée écoulée depuis la marque précédente.
+ */
+
+#ifndef TIMINGS_H
+#define TIMINGS_H
+
+void timings_enable(int enabled);
+int timings_enabled();
+void timings_mark(const char* phase);
+void timings_report();
+
+#endif
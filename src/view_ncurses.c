@@ -8,7 +8,17 @@
 #include "view_ncurses.h"
 #include "model.h"
 
+static int ncurses_ready = 0;
+
 void view_ncurses_init() {
+    // Déjà initialisé : après un endwin(), un simple refresh() restaure le terminal
+    if (ncurses_ready) {
+        clear();
+        refresh();
+        timeout(0);
+        return;
+    }
+    ncurses_ready = 1;
     initscr();
     noecho();
     curs_set(FALSE);
@@ -33,6 +43,7 @@ InputType view_ncurses_get_input() {
         case 'q': case 'Q': return INPUT_QUIT;
         case 27: case 's': return INPUT_PAUSE; // ESC
         case 't': case 'T': return INPUT_SWITCH_MODE;
+        case KEY_BACKSPACE: case 127: case '\b': return INPUT_REWIND; // Répétition du terminal tant que la touche est maintenue
         default: return INPUT_NONE;
     }
 }
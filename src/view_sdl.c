@@ -1,7 +1,7 @@
 /**
  * @file view_sdl.c
  * @brief Implémentation du rendu graphique (Pixel Art procédural).
- * @details Dessine les sprites pixel par pixel pour un look rétro authentique. Gère aussi le menu Launcher.
+ * @details Les sprites pixel art sont pré-rendus dans un atlas (une texture) et dessinés à l'échelle. Gère aussi le menu Launcher.
  */
 
 #include <SDL3/SDL.h>
@@ -14,179 +14,191 @@
 #include "controller.h" 
 #include "model.h" 
 #include "audio.h" 
+#include "timings.h"
+#include "sprites.h"
+#include "bundle.h"
+#include "profiler.h"
+#include "waves.h"
 
 #define GAME_WIDTH 1000
 #define GAME_HEIGHT 600
 
 static SDL_Window* window = NULL;
 static SDL_Renderer* renderer = NULL;
+static SDL_Surface* offscreen = NULL; // Cible du rendu headless (pas de fenêtre)
 
 #define MAX_STARS 100
 typedef struct { float x, y, speed; int brightness; } Star;
 static Star stars[MAX_STARS];
 
-// --- DONNÉES SPRITES (BITMAPS 0/1) ---
-
-#define SPRITE_PLAYER_W 11
-#define SPRITE_PLAYER_H 8
-static const int sprite_player[8][11] = { 
-    {0,0,0,0,0,1,0,0,0,0,0}, {0,0,0,0,1,1,1,0,0,0,0}, {0,0,0,0,1,1,1,0,0,0,0}, {0,1,1,1,1,1,1,1,1,1,0}, 
-    {1,1,1,1,1,1,1,1,1,1,1}, {1,1,1,1,1,1,1,1,1,1,1}, {1,0,1,1,1,0,1,1,1,0,1}, {1,0,1,0,0,0,0,0,1,0,1} 
+// Teinte des ennemis par type (table des niveaux) : rouge et rose pour la formation d'origine
+static const Uint8 enemy_colors[WAVES_MAX_TYPES][3] = {
+    { 255, 50, 50 }, { 255, 80, 255 }, { 255, 200, 40 }, { 60, 255, 200 },
+    { 120, 150, 255 }, { 255, 140, 40 }, { 210, 210, 210 }, { 150, 255, 80 }
 };
 
-#define SPRITE_ENEMY_W 11
-#define SPRITE_ENEMY_H 8
-static const int sprite_enemy_1[8][11] = { 
-    {0,0,1,0,0,0,0,0,1,0,0}, {0,0,0,1,0,0,0,1,0,0,0}, {0,0,1,1,1,1,1,1,1,0,0}, {0,1,1,0,1,1,1,0,1,1,0}, 
-    {1,1,1,1,1,1,1,1,1,1,1}, {1,0,1,1,1,1,1,1,1,0,1}, {1,0,1,0,0,0,0,0,1,0,1}, {0,0,0,1,1,0,1,1,0,0,0} 
-};
-static const int sprite_enemy_2[8][11] = { 
-    {0,0,1,0,0,0,0,0,1,0,0}, {1,0,0,1,0,0,0,1,0,0,1}, {1,0,1,1,1,1,1,1,1,0,1}, {1,1,1,0,1,1,1,0,1,1,1}, 
-    {1,1,1,1,1,1,1,1,1,1,1}, {0,1,1,1,1,1,1,1,1,1,0}, {0,0,1,0,0,0,0,0,1,0,0}, {0,1,0,0,0,0,0,0,0,1,0} 
-};
+// --- OVERLAY DE PERFORMANCE (F3) ---
+#define PERF_HISTORY 120
+static int perf_overlay = 0;
+static int draw_calls = 0;          // Appels de dessin de la frame en cours
+static int last_draw_calls = 0;     // Total de la dernière frame (hors overlay)
+static float last_render_ms = 0;
+static float last_tick_ms = 0;
+static float frame_history[PERF_HISTORY];
+static int frame_history_pos = 0;
 
-#define SPRITE_UFO_W 16
-#define SPRITE_UFO_H 7
-static const int sprite_ufo[7][16] = { 
-    {0,0,0,0,0,0,1,1,1,1,0,0,0,0,0,0}, {0,0,0,1,1,1,1,1,1,1,1,1,1,0,0,0}, {0,0,1,1,1,1,1,1,1,1,1,1,1,1,0,0}, 
-    {0,1,1,0,1,1,0,1,1,0,1,1,0,1,1,0}, {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1}, {0,0,1,1,1,0,0,1,1,0,0,1,1,1,0,0}, 
-    {0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0} 
-};
+/**
+ * @brief SDL_RenderFillRect avec comptage des appels de dessin.
+ */
+static inline bool fill_rect(SDL_Renderer* ren, const SDL_FRect* rect) {
+    draw_calls++;
+    return SDL_RenderFillRect(ren, rect);
+}
 
-static const int sprite_explosion[8][11] = { 
-    {1,0,0,0,1,0,1,0,0,0,1}, {0,1,0,0,0,1,0,0,0,1,0}, {0,0,1,0,0,0,0,0,1,0,0}, {0,0,0,1,1,1,1,1,0,0,0}, 
-    {1,0,0,1,1,0,1,1,0,0,1}, {0,0,0,1,1,1,1,1,0,0,0}, {0,1,0,0,0,1,0,0,0,1,0}, {1,0,0,0,1,0,1,0,0,0,1} 
-};
+// Atlas des sprites et glyphes (une seule texture, teintée à l'affichage)
+static SDL_Texture* atlas_texture = NULL;
+static AtlasRect atlas_rects[ATLAS_ENTRY_COUNT];
 
-#define SPRITE_SHIELD_W 22
-#define SPRITE_SHIELD_H 16
-static const int sprite_shield_full[16][22] = { 
-    {0,0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0}, {0,0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0}, 
-    {0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0}, {0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0}, 
-    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1}, {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1}, 
-    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1}, {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1}, 
-    {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1}, {1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1}, 
-    {1,1,1,1,1,1,1,1,0,0,0,0,0,0,1,1,1,1,1,1,1,1}, {1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,1,1,1,1,1,1,1}, 
-    {1,1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1,1}, {1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1}, 
-    {1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1}, {1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1} 
-};
-static const int sprite_shield_damaged[16][22] = { 
-    {0,0,0,0,1,1,1,0,1,1,1,1,1,1,0,1,1,1,0,0,0,0}, {0,0,0,1,1,1,1,1,1,0,1,1,0,1,1,1,1,1,1,0,0,0}, 
-    {0,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,1,0,0}, {0,1,1,1,0,1,1,1,1,1,0,0,1,1,1,1,1,1,1,1,1,0}, 
-    {1,1,1,1,1,1,1,0,1,1,1,1,1,1,0,1,1,1,1,1,1,1}, {1,1,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,1,1}, 
-    {1,1,1,1,1,1,0,0,1,1,1,1,1,1,0,0,1,1,1,1,1,1}, {1,1,1,1,1,1,1,1,1,1,0,0,1,1,1,1,1,1,1,0,1,1}, 
-    {1,0,1,1,1,0,1,1,1,1,1,1,1,1,1,0,1,1,1,1,1,1}, {1,1,1,1,1,1,1,1,0,1,1,1,1,0,1,1,1,1,0,1,1,1}, 
-    {1,1,1,0,1,1,1,1,0,0,0,0,0,0,1,1,1,1,1,1,1,0}, {1,1,1,1,1,1,1,0,0,0,0,0,0,0,0,1,1,0,1,1,1,1}, 
-    {1,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,1,1,1,0,1,1}, {1,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,1,1,1,1,1}, 
-    {1,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1,1}, {1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,1,0} 
-};
-static const int sprite_shield_critical[16][22] = { 
-    {0,0,0,0,1,0,1,0,0,0,1,1,0,0,0,1,0,1,0,0,0,0}, {0,0,0,0,1,0,0,1,0,0,1,1,0,0,1,0,0,1,0,0,0,0}, 
-    {0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0}, {0,1,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,1,0}, 
-    {1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1}, {1,0,0,1,0,0,0,0,0,0,1,1,0,0,0,0,0,0,1,0,0,1}, 
-    {0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0}, {0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0}, 
-    {1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1}, {0,0,0,0,0,0,0,1,0,0,1,1,0,0,1,0,0,0,0,0,0,0}, 
-    {1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,1,0,1}, {0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0}, 
-    {1,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,1}, {0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0}, 
-    {1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,1}, {1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,1} 
-};
+// --- ATLAS ---
 
-// --- POLICE ---
-static const unsigned char font_data[39][5] = {
-    {0b01110, 0b10001, 0b11111, 0b10001, 0b10001}, // A
-    {0b11110, 0b10001, 0b11110, 0b10001, 0b11110}, // B
-    {0b01110, 0b10001, 0b10000, 0b10001, 0b01110}, // C
-    {0b11110, 0b10001, 0b10001, 0b10001, 0b11110}, // D
-    {0b11111, 0b10000, 0b11110, 0b10000, 0b11111}, // E
-    {0b11111, 0b10000, 0b11110, 0b10000, 0b10000}, // F
-    {0b01111, 0b10000, 0b10111, 0b10001, 0b01110}, // G
-    {0b10001, 0b10001, 0b11111, 0b10001, 0b10001}, // H
-    {0b01110, 0b00100, 0b00100, 0b00100, 0b01110}, // I
-    {0b00111, 0b00010, 0b00010, 0b10010, 0b01100}, // J
-    {0b10001, 0b10010, 0b11100, 0b10010, 0b10001}, // K
-    {0b10000, 0b10000, 0b10000, 0b10000, 0b11111}, // L
-    {0b10001, 0b11011, 0b10101, 0b10001, 0b10001}, // M
-    {0b10001, 0b11001, 0b10101, 0b10011, 0b10001}, // N
-    {0b01110, 0b10001, 0b10001, 0b10001, 0b01110}, // O
-    {0b11110, 0b10001, 0b11110, 0b10000, 0b10000}, // P
-    {0b01110, 0b10001, 0b10001, 0b10010, 0b01101}, // Q
-    {0b11110, 0b10001, 0b11110, 0b10010, 0b10001}, // R
-    {0b01111, 0b10000, 0b01110, 0b00001, 0b11110}, // S
-    {0b11111, 0b00100, 0b00100, 0b00100, 0b00100}, // T
-    {0b10001, 0b10001, 0b10001, 0b10001, 0b01110}, // U
-    {0b10001, 0b10001, 0b10001, 0b01010, 0b00100}, // V
-    {0b10001, 0b10001, 0b10101, 0b11011, 0b10001}, // W
-    {0b10001, 0b01010, 0b00100, 0b01010, 0b10001}, // X
-    {0b10001, 0b10001, 0b01110, 0b00100, 0b00100}, // Y
-    {0b11111, 0b00010, 0b00100, 0b01000, 0b11111}, // Z
-    {0b00000, 0b00000, 0b00000, 0b00000, 0b00000}, // ESPACE
-    {0b01110, 0b10001, 0b10001, 0b10001, 0b01110}, // 0
-    {0b00100, 0b01100, 0b00100, 0b00100, 0b01110}, // 1
-    {0b01110, 0b10001, 0b00010, 0b00100, 0b11111}, // 2
-    {0b11110, 0b00001, 0b01110, 0b00001, 0b11110}, // 3
-    {0b00010, 0b00110, 0b01010, 0b11111, 0b00010}, // 4
-    {0b11111, 0b10000, 0b11110, 0b00001, 0b11110}, // 5
-    {0b01110, 0b10000, 0b11110, 0b10001, 0b01110}, // 6
-    {0b11111, 0b00001, 0b00010, 0b00100, 0b00100}, // 7
-    {0b01110, 0b10001, 0b01110, 0b10001, 0b01110}, // 8
-    {0b01110, 0b10001, 0b01111, 0b00001, 0b01110}, // 9
-    {0b00000, 0b00000, 0b11111, 0b00000, 0b00000}, // '-'
-    {0b00100, 0b00100, 0b11111, 0b00100, 0b00100}  // '+'
-};
+/**
+ * @brief Crée la texture de l'atlas depuis le bundle (ou le reconstruit s'il est absent).
+ */
+static void atlas_init() {
+    size_t size = 0;
+    const AtlasHeader* h = (const AtlasHeader*)bundle_get("atlas", &size);
+    void* baked = NULL;
+    if (!h || size < sizeof(AtlasHeader) || h->count != ATLAS_ENTRY_COUNT ||
+        size < sizeof(AtlasHeader) + (size_t)h->width * h->height) {
+        size = sprites_atlas_size();
+        baked = SDL_malloc(size);
+        if (!baked) return;
+        sprites_bake_atlas(baked);
+        h = (const AtlasHeader*)baked;
+    }
+    memcpy(atlas_rects, h->rects, sizeof(atlas_rects));
+
+    // Couverture 8 bits -> RGBA blanc : la couleur vient du color mod de la texture
+    const unsigned char* coverage = (const unsigned char*)h + sizeof(AtlasHeader);
+    Uint32* pixels = SDL_malloc((size_t)h->width * h->height * sizeof(Uint32));
+    if (pixels) {
+        for (int i = 0; i < h->width * h->height; i++) pixels[i] = coverage[i] ? 0xFFFFFFFFu : 0;
+        atlas_texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, h->width, h->height);
+        if (atlas_texture) {
+            SDL_UpdateTexture(atlas_texture, NULL, pixels, h->width * sizeof(Uint32));
+            SDL_SetTextureBlendMode(atlas_texture, SDL_BLENDMODE_BLEND);
+            SDL_SetTextureScaleMode(atlas_texture, SDL_SCALEMODE_NEAREST);
+        }
+        SDL_free(pixels);
+    }
+    SDL_free(baked);
+}
+
+/**
+ * @brief Dessine une entrée de l'atlas (sprite ou glyphe) mise à l'échelle et teintée.
+ */
+static void draw_atlas_entry(SDL_Renderer* ren, int entry, float x, float y, float scale, Uint8 r, Uint8 g, Uint8 b, Uint8 a) {
+    if (!atlas_texture) return;
+    const AtlasRect* ar = &atlas_rects[entry];
+    SDL_FRect src = { (float)ar->x, (float)ar->y, (float)ar->w, (float)ar->h };
+    SDL_FRect dst = { x, y, ar->w * scale, ar->h * scale };
+    SDL_SetTextureColorMod(atlas_texture, r, g, b);
+    SDL_SetTextureAlphaMod(atlas_texture, a);
+    SDL_RenderTexture(ren, atlas_texture, &src, &dst);
+    draw_calls++;
+}
 
 // --- FONCTIONS DE DESSIN ---
 
-void draw_sprite(SDL_Renderer* ren, float x, float y, const int* sprite_data, int w, int h, float scale, int r, int g, int b) { 
+void draw_sprite(SDL_Renderer* ren, float x, float y, SpriteId sprite, float scale, int r, int g, int b) { 
     SDL_SetRenderDrawColor(ren, r, g, b, 255); 
-    for(int row=0; row<h; row++) for(int col=0; col<w; col++) 
-        if(sprite_data[row*w + col]) { 
-            SDL_FRect p={x+(col*scale), y+(row*scale), scale, scale}; 
-            SDL_RenderFillRect(ren, &p); 
-        } 
+    draw_atlas_entry(ren, sprite, x, y, scale, r, g, b, 255);
 }
 
-void draw_sprite_alpha(SDL_Renderer* ren, float x, float y, const int* sprite_data, int w, int h, float scale, int r, int g, int b, int a) { 
-    SDL_SetRenderDrawBlendMode(ren, SDL_BLENDMODE_BLEND); 
-    SDL_SetRenderDrawColor(ren, r, g, b, a); 
-    for(int row=0; row<h; row++) for(int col=0; col<w; col++) 
-        if(sprite_data[row*w + col]) { 
-            SDL_FRect p={x+(col*scale), y+(row*scale), scale, scale}; 
-            SDL_RenderFillRect(ren, &p); 
-        } 
-    SDL_SetRenderDrawBlendMode(ren, SDL_BLENDMODE_NONE);
+void draw_sprite_alpha(SDL_Renderer* ren, float x, float y, SpriteId sprite, float scale, int r, int g, int b, int a) { 
+    draw_atlas_entry(ren, sprite, x, y, scale, r, g, b, a);
 }
 
 void draw_text(SDL_Renderer* ren, float x, float y, const char* text, float size) { 
     if (!ren || !text) return; 
+    Uint8 r, g, b, a;
+    SDL_GetRenderDrawColor(ren, &r, &g, &b, &a);
     float cx = x; 
     for (int i=0; text[i]; i++) { 
-        int idx = 26; 
-        char c = toupper(text[i]); 
-        if (c >= 'A' && c <= 'Z') idx = c - 'A'; 
-        else if (c >= '0' && c <= '9') idx = 27 + (c - '0'); 
-        else if (c == '-') idx = 37; 
-        else if (c == '+') idx = 38; 
-
-        for (int r=0; r<5; r++) 
-            for (int cl=0; cl<5; cl++) 
-                if ((font_data[idx][r] >> (4-cl)) & 1) { 
-                    SDL_FRect p={cx+(cl*size), y+(r*size), size, size}; 
-                    SDL_RenderFillRect(ren, &p); 
-                } 
+        int idx = font_glyph_index(text[i]); 
+        if (idx != 26) draw_atlas_entry(ren, SPRITE_COUNT + idx, cx, y, size, r, g, b, a);
         cx += (6*size); 
     } 
 }
 
 void draw_text_centered(SDL_Renderer* ren, float y, const char* text, float size) { if (!ren || !text) return; int len = strlen(text); float w = len * 6 * size; draw_text(ren, (GAME_WIDTH - w)/2.0f, y, text, size); }
-void draw_heart(SDL_Renderer* ren, float x, float y, int filled, float size) { static const unsigned char f[] = { 0b01010, 0b11111, 0b11111, 0b01110, 0b00100 }; static const unsigned char e[] = { 0b01010, 0b10101, 0b10001, 0b01010, 0b00100 }; const unsigned char* p = filled ? f : e; for(int r=0; r<5; r++) for(int c=0; c<5; c++) if((p[r]>>(4-c))&1) { SDL_FRect px={x+(c*size), y+(r*size), size, size}; SDL_RenderFillRect(ren, &px); } }
-void draw_invader_icon(SDL_Renderer* ren, float x, float y, float s) { SDL_FRect rects[] = { {2*s,0,s,s}, {8*s,0,s,s}, {3*s,1*s,5*s,s}, {2*s,2*s,7*s,s}, {1*s,3*s,2*s,s}, {4*s,3*s,3*s,s}, {8*s,3*s,2*s,s}, {1*s,4*s,9*s,s}, {2*s,5*s,1*s,s}, {8*s,5*s,1*s,s}, {3*s,6*s,1*s,s}, {4*s,6*s,1*s,s}, {6*s,6*s,1*s,s}, {7*s,6*s,1*s,s} }; for(size_t i=0; i<sizeof(rects)/sizeof(SDL_FRect); i++) { SDL_FRect r=rects[i]; r.x+=x; r.y+=y; SDL_RenderFillRect(ren, &r); } }
+void draw_heart(SDL_Renderer* ren, float x, float y, int filled, float size) { static const unsigned char f[] = { 0b01010, 0b11111, 0b11111, 0b01110, 0b00100 }; static const unsigned char e[] = { 0b01010, 0b10101, 0b10001, 0b01010, 0b00100 }; const unsigned char* p = filled ? f : e; for(int r=0; r<5; r++) for(int c=0; c<5; c++) if((p[r]>>(4-c))&1) { SDL_FRect px={x+(c*size), y+(r*size), size, size}; fill_rect(ren, &px); } }
+void draw_invader_icon(SDL_Renderer* ren, float x, float y, float s) { SDL_FRect rects[] = { {2*s,0,s,s}, {8*s,0,s,s}, {3*s,1*s,5*s,s}, {2*s,2*s,7*s,s}, {1*s,3*s,2*s,s}, {4*s,3*s,3*s,s}, {8*s,3*s,2*s,s}, {1*s,4*s,9*s,s}, {2*s,5*s,1*s,s}, {8*s,5*s,1*s,s}, {3*s,6*s,1*s,s}, {4*s,6*s,1*s,s}, {6*s,6*s,1*s,s}, {7*s,6*s,1*s,s} }; for(size_t i=0; i<sizeof(rects)/sizeof(SDL_FRect); i++) { SDL_FRect r=rects[i]; r.x+=x; r.y+=y; fill_rect(ren, &r); } }
 void init_stars() { for(int i=0; i<MAX_STARS; i++) { stars[i].x=rand()%GAME_WIDTH; stars[i].y=rand()%GAME_HEIGHT; stars[i].speed=1+(rand()%5)*0.5f; stars[i].brightness=100+(rand()%155); } }
 
-void view_sdl_init() { SDL_SetHint("SDL_RENDER_SCALE_QUALITY", "nearest"); if (!SDL_Init(SDL_INIT_VIDEO)) exit(1); window = SDL_CreateWindow("Space Invaders", GAME_WIDTH, GAME_HEIGHT, SDL_WINDOW_RESIZABLE); SDL_SetWindowResizable(window, true); renderer = SDL_CreateRenderer(window, NULL); SDL_SetRenderLogicalPresentation(renderer, GAME_WIDTH, GAME_HEIGHT, SDL_LOGICAL_PRESENTATION_LETTERBOX); init_stars(); }
+void view_sdl_init() { 
+    // Fenêtre déjà créée (retour depuis Ncurses) : on la réaffiche simplement
+    if (window) { view_sdl_show(); return; }
+    SDL_SetHint("SDL_RENDER_SCALE_QUALITY", "nearest"); 
+    if (!SDL_Init(SDL_INIT_VIDEO)) exit(1); 
+    timings_mark("SDL_Init (video)");
+    window = SDL_CreateWindow("Space Invaders", GAME_WIDTH, GAME_HEIGHT, SDL_WINDOW_RESIZABLE); 
+    SDL_SetWindowResizable(window, true); 
+    timings_mark("fenetre");
+    renderer = SDL_CreateRenderer(window, NULL); 
+    SDL_SetRenderLogicalPresentation(renderer, GAME_WIDTH, GAME_HEIGHT, SDL_LOGICAL_PRESENTATION_LETTERBOX); 
+    timings_mark("renderer");
+    atlas_init();
+    timings_mark("atlas");
+    init_stars(); 
+}
+
+/**
+ * @brief Rendu sans fenêtre ni GPU : renderer logiciel SDL dessinant dans une surface mémoire.
+ * @details Utilisé par le benchmark et le mode headless ; le chemin de rendu est celui du jeu.
+ */
+int view_sdl_init_headless(int width, int height) {
+    if (renderer) return 1;
+    offscreen = SDL_CreateSurface(width, height, SDL_PIXELFORMAT_XRGB8888);
+    if (!offscreen) return 0;
+    renderer = SDL_CreateSoftwareRenderer(offscreen);
+    if (!renderer) { SDL_DestroySurface(offscreen); offscreen = NULL; return 0; }
+    SDL_SetRenderLogicalPresentation(renderer, GAME_WIDTH, GAME_HEIGHT, SDL_LOGICAL_PRESENTATION_LETTERBOX);
+    atlas_init();
+    init_stars();
+    return 1;
+}
+
+SDL_Surface* view_sdl_get_offscreen() { return offscreen; }
+
+int view_sdl_get_draw_calls() { return last_draw_calls; }
+
+/**
+ * @brief Masque la fenêtre sans détruire le renderer ni quitter SDL (bascule vers Ncurses).
+ */
+void view_sdl_hide() {
+    if (window) SDL_HideWindow(window);
+}
+
+/**
+ * @brief Réaffiche la fenêtre masquée et purge les événements reçus pendant l'absence.
+ */
+void view_sdl_show() {
+    if (!window) return;
+    SDL_ShowWindow(window);
+    SDL_RaiseWindow(window);
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+}
 
 void view_sdl_shutdown() { 
+    if (atlas_texture) SDL_DestroyTexture(atlas_texture);
+    atlas_texture = NULL;
     if (renderer) SDL_DestroyRenderer(renderer); 
     if (window) SDL_DestroyWindow(window); 
+    if (offscreen) SDL_DestroySurface(offscreen);
+    renderer = NULL;
+    window = NULL;
+    offscreen = NULL;
     SDL_Quit(); 
 }
 
@@ -200,6 +212,7 @@ InputType view_sdl_get_input(const GameState* state) {
             if (event.key.key == SDLK_S) return INPUT_PAUSE;
             if (event.key.key == SDLK_Q) return INPUT_QUIT;
             if (event.key.key == SDLK_T) return INPUT_SWITCH_MODE;
+            if (event.key.key == SDLK_F3) return INPUT_DEBUG_HUD;
             if (event.key.key == SDLK_B) return INPUT_SAVE;
             if (event.key.key == SDLK_C) return INPUT_LOAD;
             if (event.key.key == SDLK_1 || event.key.key == SDLK_KP_1) return INPUT_1;
@@ -209,6 +222,7 @@ InputType view_sdl_get_input(const GameState* state) {
         } 
     } 
     const bool* k = SDL_GetKeyboardState(NULL); 
+    if (k[SDL_SCANCODE_BACKSPACE]) return INPUT_REWIND;
     if (k[SDL_GetScancodeFromKey(state->settings.key_left, NULL)]) return INPUT_LEFT;
     if (k[SDL_GetScancodeFromKey(state->settings.key_right, NULL)]) return INPUT_RIGHT;
     return INPUT_NONE; 
@@ -219,45 +233,109 @@ InputType view_sdl_menu_input(int load_mode) {
     return INPUT_NONE;
 }
 
+void view_sdl_toggle_perf_overlay() {
+    perf_overlay = !perf_overlay;
+}
+
+// Classement de la dernière partie, affiché sur l'écran de game over (0 : inconnu)
+static long game_over_rank = 0, game_over_total = 0;
+
+void view_sdl_set_rank(long rank, long total) {
+    game_over_rank = rank;
+    game_over_total = total;
+}
+
+void view_sdl_perf_sample(float frame_ms, float tick_ms) {
+    frame_history[frame_history_pos] = frame_ms;
+    frame_history_pos = (frame_history_pos + 1) % PERF_HISTORY;
+    last_tick_ms = tick_ms;
+}
+
+/**
+ * @brief Overlay : FPS, temps simulation/rendu, appels de dessin, entités, audio et courbe des temps de frame.
+ */
+static void draw_perf_overlay(const GameState* state) {
+    EntityCounts counts;
+    model_count_entities(state, &counts);
+
+    float sum = 0, worst = 0;
+    for (int i = 0; i < PERF_HISTORY; i++) { sum += frame_history[i]; if (frame_history[i] > worst) worst = frame_history[i]; }
+    float avg = sum / PERF_HISTORY;
+
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 180);
+    SDL_FRect bg = {10, 50, 330, 190}; fill_rect(renderer, &bg);
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+
+    char buf[64];
+    SDL_SetRenderDrawColor(renderer, 0, 255, 0, 255);
+    snprintf(buf, 64, "FPS %.1f  FRAME %.2f MS", avg > 0 ? 1000.0f / avg : 0.0f, avg); draw_text(renderer, 20, 60, buf, 2);
+    snprintf(buf, 64, "TICK %.3f MS  RENDU %.3f MS", last_tick_ms, last_render_ms); draw_text(renderer, 20, 76, buf, 2);
+    snprintf(buf, 64, "DRAW CALLS %d  PIRE %.1f MS", last_draw_calls, worst); draw_text(renderer, 20, 92, buf, 2);
+    snprintf(buf, 64, "ENNEMIS %d  TIRS %d:%d", counts.enemies, counts.shots, counts.enemy_shots); draw_text(renderer, 20, 108, buf, 2);
+    snprintf(buf, 64, "EXPL %d  BOUCLIERS %d  UFO %d", counts.explosions, counts.shields, counts.ufo); draw_text(renderer, 20, 124, buf, 2);
+    snprintf(buf, 64, "AUDIO %d O  VOIX %d", audio_get_queued_bytes(), audio_get_active_voices()); draw_text(renderer, 20, 140, buf, 2);
+
+    // Courbe glissante : 1 px = 0.5 ms, ligne de repère à 16.7 ms (60 FPS)
+    float gx = 20, gy = 160, gh = 70;
+    SDL_SetRenderDrawColor(renderer, 80, 80, 80, 255);
+    SDL_FRect target = {gx, gy + gh - 16.7f * 2, PERF_HISTORY * 2.5f, 1}; fill_rect(renderer, &target);
+    for (int i = 0; i < PERF_HISTORY; i++) {
+        float ms = frame_history[(frame_history_pos + i) % PERF_HISTORY];
+        float h = ms * 2; if (h > gh) h = gh;
+        if (ms > 33.4f) SDL_SetRenderDrawColor(renderer, 255, 50, 50, 255);
+        else if (ms > 17.5f) SDL_SetRenderDrawColor(renderer, 255, 200, 0, 255);
+        else SDL_SetRenderDrawColor(renderer, 0, 200, 0, 255);
+        SDL_FRect bar = {gx + i * 2.5f, gy + gh - h, 2, h}; fill_rect(renderer, &bar);
+    }
+}
+
 void view_sdl_render(const GameState* state, int paused, int save_mode) {
     if (!renderer) return;
+    Uint64 render_start = SDL_GetPerformanceCounter();
+    draw_calls = 0;
+    PROFILE_BEGIN(prof_background, "rendu fond");
     SDL_SetRenderDrawColor(renderer, 5, 5, 20, 255); SDL_RenderClear(renderer);
-    if (!paused && !state->game_over) { for(int i=0; i<MAX_STARS; i++) { stars[i].y += stars[i].speed; if(stars[i].y > GAME_HEIGHT) { stars[i].y=0; stars[i].x=rand()%GAME_WIDTH; } SDL_SetRenderDrawColor(renderer, 255, 255, 255, stars[i].brightness); SDL_FRect s = { stars[i].x, stars[i].y, 2, 2 }; SDL_RenderFillRect(renderer, &s); } }
+    if (!paused && !state->game_over) { for(int i=0; i<MAX_STARS; i++) { stars[i].y += stars[i].speed; if(stars[i].y > GAME_HEIGHT) { stars[i].y=0; stars[i].x=rand()%GAME_WIDTH; } SDL_SetRenderDrawColor(renderer, 255, 255, 255, stars[i].brightness); SDL_FRect s = { stars[i].x, stars[i].y, 2, 2 }; fill_rect(renderer, &s); } }
+    PROFILE_END(prof_background);
 
     if (!state->game_over) {
+        PROFILE_BEGIN(prof_entities, "rendu entites");
         int anim = (SDL_GetTicks() / 500) % 2;
         float p_sc = (float)PLAYER_W / SPRITE_PLAYER_W;
-        draw_sprite(renderer, state->pos.x, state->pos.y, (const int*)sprite_player, SPRITE_PLAYER_W, SPRITE_PLAYER_H, p_sc, 50, 255, 100);
+        draw_sprite(renderer, state->pos.x, state->pos.y, SPRITE_PLAYER, p_sc, 50, 255, 100);
         float e_sc = (float)ENEMY_W / SPRITE_ENEMY_W;
-        for (int i=0; i<state->enemy_count; i++) { if (state->enemies[i].alive) { const int* sp = (anim == 0) ? (const int*)sprite_enemy_1 : (const int*)sprite_enemy_2; int g = (i%2==0) ? 50 : 80; int b = (i%2==0) ? 50 : 255; draw_sprite(renderer, state->enemies[i].pos.x, state->enemies[i].pos.y, sp, SPRITE_ENEMY_W, SPRITE_ENEMY_H, e_sc, 255, g, b); } }
-        for (int i=0; i<MAX_EXPLOSIONS; i++) { if (state->explosions[i].active) { int g = (state->explosions[i].timer * 255) / 15; draw_sprite(renderer, state->explosions[i].x, state->explosions[i].y, (const int*)sprite_explosion, 11, 8, e_sc, 255, g, 0); } }
-        SDL_SetRenderDrawColor(renderer, 255, 255, 0, 255); for (int i=0; i<MAX_SHOTS; i++) if (state->shots[i].active) { SDL_FRect s = { (float)state->shots[i].pos.x, (float)state->shots[i].pos.y, 4, 15 }; SDL_RenderFillRect(renderer, &s); }
-        SDL_SetRenderDrawColor(renderer, 200, 200, 255, 255); for (int i=0; i<MAX_ENEMY_SHOTS; i++) if (state->enemy_shots[i].active) { SDL_FRect es = { (float)state->enemy_shots[i].pos.x, (float)state->enemy_shots[i].pos.y, 4, 15 }; SDL_RenderFillRect(renderer, &es); }
+        for (int i=0; i<state->enemy_count; i++) { if (state->enemies[i].alive) { SpriteId sp = (anim == 0) ? SPRITE_ENEMY_1 : SPRITE_ENEMY_2; const Uint8* c = enemy_colors[state->enemies[i].type & (WAVES_MAX_TYPES - 1)]; draw_sprite(renderer, state->enemies[i].pos.x, state->enemies[i].pos.y, sp, e_sc, c[0], c[1], c[2]); } }
+        for (int i=0; i<MAX_EXPLOSIONS; i++) { if (state->explosions[i].active) { int g = (state->explosions[i].timer * 255) / 15; draw_sprite(renderer, state->explosions[i].x, state->explosions[i].y, SPRITE_EXPLOSION, e_sc, 255, g, 0); } }
+        SDL_SetRenderDrawColor(renderer, 255, 255, 0, 255); for (int i=0; i<MAX_SHOTS; i++) if (state->shots[i].active) { SDL_FRect s = { (float)state->shots[i].pos.x, (float)state->shots[i].pos.y, SHOT_W, SHOT_H }; fill_rect(renderer, &s); }
+        SDL_SetRenderDrawColor(renderer, 200, 200, 255, 255); for (int i=0; i<MAX_ENEMY_SHOTS; i++) if (state->enemy_shots[i].active) { SDL_FRect es = { (float)state->enemy_shots[i].pos.x, (float)state->enemy_shots[i].pos.y, SHOT_W, SHOT_H }; fill_rect(renderer, &es); }
+        PROFILE_END(prof_entities);
         
+        PROFILE_BEGIN(prof_shields, "rendu boucliers");
         float shield_scale = (float)SHIELD_W / SPRITE_SHIELD_W;
         for (int i=0; i<MAX_SHIELDS; i++) {
             if (state->shields[i].active && state->shields[i].health > 0) {
                 int hp = state->shields[i].health;
-                const int* current_sprite;
-                if (hp > 7) current_sprite = (const int*)sprite_shield_full;
-                else if (hp > 3) current_sprite = (const int*)sprite_shield_damaged;
-                else current_sprite = (const int*)sprite_shield_critical;
+                SpriteId current_sprite = sprite_shield_for_health(hp);
                 int r = (10 - hp) * 25; int g = hp * 25; int b = (hp > 3) ? 255 : 50; int a = 100 + (hp * 15); 
                 
                 if (r > 255) r = 255; 
                 if (g > 255) g = 255; 
                 if (a > 255) a = 255;
 
-                draw_sprite_alpha(renderer, state->shields[i].pos.x, state->shields[i].pos.y, current_sprite, SPRITE_SHIELD_W, SPRITE_SHIELD_H, shield_scale, r, g, b, a);
+                draw_sprite_alpha(renderer, state->shields[i].pos.x, state->shields[i].pos.y, current_sprite, shield_scale, r, g, b, a);
             }
         }
+        PROFILE_END(prof_shields);
 
-        if (state->ufo.active) { float usc = (float)UFO_W / SPRITE_UFO_W; draw_sprite(renderer, state->ufo.x, state->ufo.y, (const int*)sprite_ufo, SPRITE_UFO_W, SPRITE_UFO_H, usc, 0, 255, 255); }
+        PROFILE_BEGIN(prof_hud, "rendu hud");
+        if (state->ufo.active) { float usc = (float)UFO_W / SPRITE_UFO_W; draw_sprite(renderer, state->ufo.x, state->ufo.y, SPRITE_UFO, usc, 0, 255, 255); }
         SDL_SetRenderDrawColor(renderer, 255, 50, 50, 255); for(int i = 0; i < 3; i++) draw_heart(renderer, 20 + (i * 40), 20, (i < state->lives), 6.0f);
         SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255); char buf[32]; snprintf(buf, 32, "LEVEL %d", state->level); draw_text_centered(renderer, 20, buf, 3); snprintf(buf, 32, "SCORE %d", state->score); draw_text(renderer, GAME_WIDTH - 200, 20, buf, 3);
+        PROFILE_END(prof_hud);
 
         if (paused) {
-            SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND); SDL_SetRenderDrawColor(renderer, 0, 0, 0, 200); SDL_FRect ov = {0, 0, GAME_WIDTH, GAME_HEIGHT}; SDL_RenderFillRect(renderer, &ov); SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+            SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND); SDL_SetRenderDrawColor(renderer, 0, 0, 0, 200); SDL_FRect ov = {0, 0, GAME_WIDTH, GAME_HEIGHT}; fill_rect(renderer, &ov); SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
             SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
             if (save_mode) {
                 draw_text_centered(renderer, 150, "SAUVEGARDER", 8); draw_text_centered(renderer, 280, "CHOISIR EMPLACEMENT (1-3)", 3);
@@ -270,38 +348,44 @@ void view_sdl_render(const GameState* state, int paused, int save_mode) {
         SDL_SetRenderDrawColor(renderer, 30, 0, 0, 255); SDL_RenderClear(renderer); 
         if ((SDL_GetTicks()/400)%2) { SDL_SetRenderDrawColor(renderer, 255, 0, 0, 255); draw_text_centered(renderer, 100, "GAME OVER", 8); } 
         else { SDL_SetRenderDrawColor(renderer, 100, 0, 0, 255); draw_text_centered(renderer, 100, "GAME OVER", 8); }
-        SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255); char buf[64]; snprintf(buf, 64, "SCORE FINAL: %d", state->score); draw_text_centered(renderer, 250, buf, 5); draw_text_centered(renderer, 400, "PRESS R TO RESTART", 4); draw_text_centered(renderer, 550, "PRESS Q TO QUIT", 4);
+        SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255); char buf[64]; snprintf(buf, 64, "SCORE FINAL: %d", state->score); draw_text_centered(renderer, 250, buf, 5); if (game_over_rank > 0) { snprintf(buf, 64, "RANG %ld SUR %ld", game_over_rank, game_over_total); draw_text_centered(renderer, 320, buf, 3); } draw_text_centered(renderer, 400, "PRESS R TO RESTART", 4); draw_text_centered(renderer, 550, "PRESS Q TO QUIT", 4);
     }
+    last_render_ms = (SDL_GetPerformanceCounter() - render_start) * 1000.0f / SDL_GetPerformanceFrequency();
+    last_draw_calls = draw_calls;
+    if (perf_overlay) draw_perf_overlay(state);
+
+    PROFILE_BEGIN(prof_present, "SDL_RenderPresent");
     SDL_RenderPresent(renderer);
+    PROFILE_END(prof_present);
 }
 
 void view_sdl_render_launcher_frame(int step, GameState* state, int rebinding_idx) {
     if (!renderer) return;
     SDL_SetRenderDrawColor(renderer, 10, 10, 30, 255); SDL_RenderClear(renderer);
-    for(int i=0; i<MAX_STARS; i++) { stars[i].y += stars[i].speed; if(stars[i].y > GAME_HEIGHT) stars[i].y=0; SDL_SetRenderDrawColor(renderer, 255, 255, 255, stars[i].brightness); SDL_FRect s = { stars[i].x, stars[i].y, 2, 2 }; SDL_RenderFillRect(renderer, &s); }
+    for(int i=0; i<MAX_STARS; i++) { stars[i].y += stars[i].speed; if(stars[i].y > GAME_HEIGHT) stars[i].y=0; SDL_SetRenderDrawColor(renderer, 255, 255, 255, stars[i].brightness); SDL_FRect s = { stars[i].x, stars[i].y, 2, 2 }; fill_rect(renderer, &s); }
 
     float wx, wy, mx, my; SDL_GetMouseState(&wx, &wy); SDL_RenderCoordinatesFromWindow(renderer, wx, wy, &mx, &my);
 
     // --- HOME (0) ---
     if (step == 0) {
         draw_text_centered(renderer, 80, "SPACE INVADERS", 8);
-        float msc = 5.0f; draw_sprite(renderer, (GAME_WIDTH/2) - 150, 180, (const int*)sprite_enemy_1, SPRITE_ENEMY_W, SPRITE_ENEMY_H, msc, 255, 50, 50);  
-        draw_sprite(renderer, (GAME_WIDTH/2) + 100, 180, (const int*)sprite_enemy_2, SPRITE_ENEMY_W, SPRITE_ENEMY_H, msc, 255, 50, 200);
-        float psc = 6.0f; draw_sprite(renderer, (GAME_WIDTH - (SPRITE_PLAYER_W*psc))/2, 180, (const int*)sprite_player, SPRITE_PLAYER_W, SPRITE_PLAYER_H, psc, 50, 255, 50);
+        float msc = 5.0f; draw_sprite(renderer, (GAME_WIDTH/2) - 150, 180, SPRITE_ENEMY_1, msc, 255, 50, 50);  
+        draw_sprite(renderer, (GAME_WIDTH/2) + 100, 180, SPRITE_ENEMY_2, msc, 255, 50, 200);
+        float psc = 6.0f; draw_sprite(renderer, (GAME_WIDTH - (SPRITE_PLAYER_W*psc))/2, 180, SPRITE_PLAYER, psc, 50, 255, 50);
 
         int h1 = (mx > 300 && mx < 700 && my > 300 && my < 380);
         SDL_SetRenderDrawColor(renderer, h1?50:20, h1?150:60, h1?50:20, 255); 
-        SDL_FRect r1 = {300, 300, 400, 80}; SDL_RenderFillRect(renderer, &r1);
+        SDL_FRect r1 = {300, 300, 400, 80}; fill_rect(renderer, &r1);
         SDL_SetRenderDrawColor(renderer, 255, 255, 0, 255); draw_text_centered(renderer, 325, "NOUVELLE PARTIE", 4);
         
         int h2 = (mx > 300 && mx < 700 && my > 400 && my < 480);
         SDL_SetRenderDrawColor(renderer, h2?50:20, h2?50:20, h2?150:60, 255); 
-        SDL_FRect r2 = {300, 400, 400, 80}; SDL_RenderFillRect(renderer, &r2);
+        SDL_FRect r2 = {300, 400, 400, 80}; fill_rect(renderer, &r2);
         SDL_SetRenderDrawColor(renderer, 0, 255, 255, 255); draw_text_centered(renderer, 425, "CHARGER PARTIE", 4);
         
         int h_param = (mx > 20 && mx < 220 && my > 520 && my < 570);
         SDL_SetRenderDrawColor(renderer, h_param?100:50, h_param?100:50, h_param?100:50, 255);
-        SDL_FRect r_param = {20, 520, 200, 50}; SDL_RenderFillRect(renderer, &r_param);
+        SDL_FRect r_param = {20, 520, 200, 50}; fill_rect(renderer, &r_param);
         SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255); draw_text(renderer, 40, 535, "PARAMETRES", 3);
 
         SDL_SetRenderDrawColor(renderer, 100, 100, 100, 255); draw_text_centered(renderer, 580, "BY GEMINI & CHEF", 2);
@@ -313,14 +397,14 @@ void view_sdl_render_launcher_frame(int step, GameState* state, int rebinding_id
             float by = 280 + (i-1)*60;
             int h = (mx > 200 && mx < 800 && my > by && my < by+50);
             SDL_SetRenderDrawColor(renderer, h?50:20, h?50:20, h?100:40, 255);
-            SDL_FRect r = {200, by, 600, 50}; SDL_RenderFillRect(renderer, &r);
+            SDL_FRect r = {200, by, 600, 50}; fill_rect(renderer, &r);
             SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255); SDL_RenderRect(renderer, &r);
             int sc, lv; char txt[64]; if(model_get_slot_info(i, &sc, &lv)) snprintf(txt, 64, "SLOT %d : LVL %d - %d PTS", i, lv, sc); else snprintf(txt, 64, "SLOT %d : VIDE", i);
             SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255); draw_text_centered(renderer, by+15, txt, 3);
         }
         int hret = (mx > 350 && mx < 650 && my > 480 && my < 530);
         SDL_SetRenderDrawColor(renderer, hret?150:60, hret?50:20, hret?50:20, 255); 
-        SDL_FRect b = {350, 480, 300, 50}; SDL_RenderFillRect(renderer, &b);
+        SDL_FRect b = {350, 480, 300, 50}; fill_rect(renderer, &b);
         SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255); draw_text_centered(renderer, 495, "RETOUR", 3);
     }
     // --- VUE (2) ---
@@ -329,18 +413,18 @@ void view_sdl_render_launcher_frame(int step, GameState* state, int rebinding_id
         SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
         int h_sdl = (mx < 500 && my < 520);
         if(h_sdl) SDL_SetRenderDrawColor(renderer, 40, 150, 40, 100); else SDL_SetRenderDrawColor(renderer, 20, 60, 20, 100);
-        SDL_FRect l = {0, 150, 500, 350}; SDL_RenderFillRect(renderer, &l);
+        SDL_FRect l = {0, 150, 500, 350}; fill_rect(renderer, &l);
         SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE); 
         draw_invader_icon(renderer, 200, 250, 8.0f); draw_text(renderer, 210, 400, "SDL", 5);
         SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
         if(!h_sdl && my < 520) SDL_SetRenderDrawColor(renderer, 150, 150, 40, 100); else SDL_SetRenderDrawColor(renderer, 60, 60, 20, 100);
-        SDL_FRect r = {500, 150, 500, 350}; SDL_RenderFillRect(renderer, &r);
+        SDL_FRect r = {500, 150, 500, 350}; fill_rect(renderer, &r);
         SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
         draw_text(renderer, 700, 300, "TXT", 10);
-        SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255); SDL_FRect sep = {495, 150, 10, 350}; SDL_RenderFillRect(renderer, &sep);
+        SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255); SDL_FRect sep = {495, 150, 10, 350}; fill_rect(renderer, &sep);
         int hret = (my > 520 && my < 570 && mx > 350 && mx < 650);
         SDL_SetRenderDrawColor(renderer, hret?150:60, hret?50:20, hret?50:20, 255); 
-        SDL_FRect b = {350, 520, 300, 50}; SDL_RenderFillRect(renderer, &b);
+        SDL_FRect b = {350, 520, 300, 50}; fill_rect(renderer, &b);
         SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255); draw_text_centered(renderer, 535, "RETOUR", 3);
     }
     // --- PARAMETRES (3) ---
@@ -353,26 +437,26 @@ void view_sdl_render_launcher_frame(int step, GameState* state, int rebinding_id
         SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
         draw_text(renderer, 100, 120, buf, 4);
         int h_v_m = (mx > 600 && mx < 650 && my > 110 && my < 160);
-        SDL_SetRenderDrawColor(renderer, h_v_m?150:50, 50, 50, 255); SDL_FRect vm = {600, 110, 50, 50}; SDL_RenderFillRect(renderer, &vm);
+        SDL_SetRenderDrawColor(renderer, h_v_m?150:50, 50, 50, 255); SDL_FRect vm = {600, 110, 50, 50}; fill_rect(renderer, &vm);
         SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255); draw_text(renderer, 615, 120, "-", 4);
         int h_v_p = (mx > 670 && mx < 720 && my > 110 && my < 160);
-        SDL_SetRenderDrawColor(renderer, 50, h_v_p?150:50, 50, 255); SDL_FRect vp = {670, 110, 50, 50}; SDL_RenderFillRect(renderer, &vp);
+        SDL_SetRenderDrawColor(renderer, 50, h_v_p?150:50, 50, 255); SDL_FRect vp = {670, 110, 50, 50}; fill_rect(renderer, &vp);
         SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255); draw_text(renderer, 685, 120, "+", 4);
 
         // VITESSE
         snprintf(buf, 64, "VITESSE: %d", state->settings.player_speed);
         draw_text(renderer, 100, 190, buf, 4);
         int h_s_m = (mx > 600 && mx < 650 && my > 180 && my < 230);
-        SDL_SetRenderDrawColor(renderer, h_s_m?150:50, 50, 50, 255); SDL_FRect sm = {600, 180, 50, 50}; SDL_RenderFillRect(renderer, &sm);
+        SDL_SetRenderDrawColor(renderer, h_s_m?150:50, 50, 50, 255); SDL_FRect sm = {600, 180, 50, 50}; fill_rect(renderer, &sm);
         SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255); draw_text(renderer, 615, 190, "-", 4);
         int h_s_p = (mx > 670 && mx < 720 && my > 180 && my < 230);
-        SDL_SetRenderDrawColor(renderer, 50, h_s_p?150:50, 50, 255); SDL_FRect sp = {670, 180, 50, 50}; SDL_RenderFillRect(renderer, &sp);
+        SDL_SetRenderDrawColor(renderer, 50, h_s_p?150:50, 50, 255); SDL_FRect sp = {670, 180, 50, 50}; fill_rect(renderer, &sp);
         SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255); draw_text(renderer, 685, 190, "+", 4);
 
         // TOUCHES
         SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
         SDL_SetRenderDrawColor(renderer, 30, 30, 50, 150);
-        SDL_FRect bg_ctrl = {50, 260, 900, 240}; SDL_RenderFillRect(renderer, &bg_ctrl);
+        SDL_FRect bg_ctrl = {50, 260, 900, 240}; fill_rect(renderer, &bg_ctrl);
         SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
 
         SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
@@ -382,7 +466,7 @@ void view_sdl_render_launcher_frame(int step, GameState* state, int rebinding_id
         const char* name_l = SDL_GetKeyName(state->settings.key_left);
         int h_k_l = (mx > 400 && mx < 800 && my > 320 && my < 360);
         SDL_SetRenderDrawColor(renderer, (rebinding_idx==0)?200:(h_k_l?80:40), 40, 40, 255);
-        SDL_FRect rkl = {400, 320, 400, 40}; SDL_RenderFillRect(renderer, &rkl);
+        SDL_FRect rkl = {400, 320, 400, 40}; fill_rect(renderer, &rkl);
         SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
         draw_text(renderer, 420, 330, (rebinding_idx == 0) ? "APPUYEZ..." : name_l, 3);
 
@@ -390,7 +474,7 @@ void view_sdl_render_launcher_frame(int step, GameState* state, int rebinding_id
         const char* name_r = SDL_GetKeyName(state->settings.key_right);
         int h_k_r = (mx > 400 && mx < 800 && my > 380 && my < 420);
         SDL_SetRenderDrawColor(renderer, (rebinding_idx==1)?200:(h_k_r?80:40), 40, 40, 255);
-        SDL_FRect rkr = {400, 380, 400, 40}; SDL_RenderFillRect(renderer, &rkr);
+        SDL_FRect rkr = {400, 380, 400, 40}; fill_rect(renderer, &rkr);
         SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
         draw_text(renderer, 420, 390, (rebinding_idx == 1) ? "APPUYEZ..." : name_r, 3);
 
@@ -398,13 +482,13 @@ void view_sdl_render_launcher_frame(int step, GameState* state, int rebinding_id
         const char* name_s = SDL_GetKeyName(state->settings.key_shoot);
         int h_k_s = (mx > 400 && mx < 800 && my > 440 && my < 480);
         SDL_SetRenderDrawColor(renderer, (rebinding_idx==2)?200:(h_k_s?80:40), 40, 40, 255);
-        SDL_FRect rks = {400, 440, 400, 40}; SDL_RenderFillRect(renderer, &rks);
+        SDL_FRect rks = {400, 440, 400, 40}; fill_rect(renderer, &rks);
         SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
         draw_text(renderer, 420, 450, (rebinding_idx == 2) ? "APPUYEZ..." : name_s, 3);
 
         int hret = (mx > 350 && mx < 650 && my > 530 && my < 580);
         SDL_SetRenderDrawColor(renderer, hret?150:60, hret?50:20, hret?50:20, 255); 
-        SDL_FRect b = {350, 530, 300, 50}; SDL_RenderFillRect(renderer, &b);
+        SDL_FRect b = {350, 530, 300, 50}; fill_rect(renderer, &b);
         SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255); draw_text_centered(renderer, 545, "RETOUR", 3);
     }
     
@@ -414,15 +498,10 @@ void view_sdl_render_launcher_frame(int step, GameState* state, int rebinding_id
 ViewMode view_sdl_show_launcher(GameState* state) {
     if (!SDL_Init(SDL_INIT_VIDEO)) return VIEW_MODE_NCURSES;
     
-    SDL_Window* win = SDL_CreateWindow("SPACE INVADERS", GAME_WIDTH, GAME_HEIGHT, SDL_WINDOW_RESIZABLE);
-    SDL_Renderer* ren = SDL_CreateRenderer(win, NULL);
-    if (!win || !ren) return VIEW_MODE_NCURSES;
-    
-    SDL_Renderer* old_renderer = renderer; 
-    renderer = ren; 
-    
-    SDL_SetRenderLogicalPresentation(ren, GAME_WIDTH, GAME_HEIGHT, SDL_LOGICAL_PRESENTATION_LETTERBOX);
-    init_stars();
+    // Même fenêtre, renderer et périphérique audio que pour la partie (pas de recréation au lancement)
+    view_sdl_init();
+    if (!window || !renderer) return VIEW_MODE_NCURSES;
+    SDL_Renderer* ren = renderer;
     
     audio_init();
     audio_set_volume(state->settings.volume);
@@ -470,8 +549,8 @@ ViewMode view_sdl_show_launcher(GameState* state) {
                     if (rebinding_idx == -1) {
                         if (mx > 600 && mx < 650 && my > 110 && my < 160) { state->settings.volume -= 10; audio_set_volume(state->settings.volume); }
                         if (mx > 670 && mx < 720 && my > 110 && my < 160) { state->settings.volume += 10; audio_set_volume(state->settings.volume); }
-                        if (mx > 600 && mx < 650 && my > 180 && my < 230) { if(state->settings.player_speed > 1) state->settings.player_speed--; }
-                        if (mx > 670 && mx < 720 && my > 180 && my < 230) { if(state->settings.player_speed < 20) state->settings.player_speed++; }
+                        if (mx > 600 && mx < 650 && my > 180 && my < 230) { if(state->settings.player_speed > PLAYER_SPEED_MIN) state->settings.player_speed--; }
+                        if (mx > 670 && mx < 720 && my > 180 && my < 230) { if(state->settings.player_speed < PLAYER_SPEED_MAX) state->settings.player_speed++; }
                         
                         if (mx > 400 && mx < 800 && my > 320 && my < 360) rebinding_idx = 0;
                         if (mx > 400 && mx < 800 && my > 380 && my < 420) rebinding_idx = 1;
@@ -489,11 +568,13 @@ ViewMode view_sdl_show_launcher(GameState* state) {
         SDL_Delay(16);
     }
     
-    audio_shutdown();
-    renderer = old_renderer; 
-    SDL_DestroyRenderer(ren); 
-    SDL_DestroyWindow(win); 
-    SDL_Quit(); 
+    timings_mark("launcher (attente joueur)");
+
+    // En mode texte, SDL reste vivant en arrière-plan pour une éventuelle bascule
+    if (choice == VIEW_MODE_NCURSES) {
+        audio_pause();
+        view_sdl_hide();
+    }
 
     return choice;
 }
\ No newline at end of file
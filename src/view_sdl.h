@@ -11,12 +11,28 @@
 void view_sdl_init();
 void view_sdl_shutdown();
 
+// Rendu headless (renderer logiciel, sans fenêtre) pour benchmarks et CI
+int view_sdl_init_headless(int width, int height);
+SDL_Surface* view_sdl_get_offscreen();
+int view_sdl_get_draw_calls(); // Appels de dessin de la dernière frame
+
+// Bascule rapide : la fenêtre, le renderer et SDL restent vivants
+void view_sdl_hide();
+void view_sdl_show();
+
 // Récupère les entrées en tenant compte des réglages personnalisés
 InputType view_sdl_get_input(const GameState* state); 
 
 InputType view_sdl_menu_input(int load_mode);
 void view_sdl_render(const GameState* state, int paused, int save_mode);
 
+// Overlay de performance (F3) : le contrôleur fournit les temps de frame et de simulation
+void view_sdl_toggle_perf_overlay();
+void view_sdl_perf_sample(float frame_ms, float tick_ms);
+
+// Classement de la partie terminée (tableau des scores), 0 pour ne rien afficher
+void view_sdl_set_rank(long rank, long total);
+
 // Affiche le Launcher (Menu principal)
 ViewMode view_sdl_show_launcher(GameState* state);
 
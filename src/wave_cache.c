@@ -0,0 +1,106 @@
+/**
+ * @file wave_cache.c
+ * @brief Implémentation du cache d'anticipation (thread SDL, une graine, emplacements indexés par niveau).
+ */
+
+#include <SDL3/SDL.h>
+#include <stdio.h>
+#include <string.h>
+#include "wave_cache.h"
+#include "waves.h"
+
+typedef struct {
+    uint64_t seed;
+    int level;
+    int ready;
+    int count;
+    Enemy enemies[MAX_ENEMIES];
+} CachedWave;
+
+static CachedWave slots[WAVE_CACHE_LOOKAHEAD]; // Le niveau n occupe l'emplacement n % WAVE_CACHE_LOOKAHEAD
+static SDL_Mutex* lock = NULL;
+static SDL_Condition* wake = NULL;
+static SDL_Thread* thread = NULL;
+static int quit = 0;
+static uint64_t cache_seed = 0;                 // Seule graine servie par le cache
+static int want_level = 0;                      // Premier niveau à préparer (dernière demande)
+
+static CachedWave* slot_for(int level) { return &slots[(unsigned)level % WAVE_CACHE_LOOKAHEAD]; }
+
+static int cached(uint64_t seed, int level) {
+    const CachedWave* w = slot_for(level);
+    return w->ready && w->seed == seed && w->level == level;
+}
+
+static int lookup(uint64_t seed, int level, Enemy* enemies) {
+    int count = 0;
+    if (seed != cache_seed) return 0; // Fixée avant le thread : lecture sans verrou
+    SDL_LockMutex(lock);
+    if (cached(seed, level)) {
+        count = slot_for(level)->count;
+        memcpy(enemies, slot_for(level)->enemies, count * sizeof(Enemy));
+    }
+    want_level = level + 1;
+    SDL_SignalCondition(wake);
+    SDL_UnlockMutex(lock);
+    return count;
+}
+
+static int SDLCALL cache_worker(void* data) {
+    (void)data;
+    Enemy buffer[MAX_ENEMIES];
+    SDL_LockMutex(lock);
+    while (!quit) {
+        uint64_t seed = cache_seed;
+        int level = -1;
+        for (int l = want_level; want_level > 0 && l < want_level + WAVE_CACHE_LOOKAHEAD && level < 0; l++) if (!cached(seed, l)) level = l;
+        if (level < 0) { SDL_WaitCondition(wake, lock); continue; }
+
+        SDL_UnlockMutex(lock); // Génération hors verrou : les parties continuent de lire le cache
+        int count = waves_generate(seed, level, buffer);
+        SDL_LockMutex(lock);
+        CachedWave* w = slot_for(level);
+        w->seed = seed;
+        w->level = level;
+        w->count = count;
+        memcpy(w->enemies, buffer, count * sizeof(Enemy));
+        w->ready = 1;
+    }
+    SDL_UnlockMutex(lock);
+    return 0;
+}
+
+int wave_cache_start(uint64_t seed) {
+    if (thread) return seed == cache_seed;
+    lock = SDL_CreateMutex();
+    wake = SDL_CreateCondition();
+    quit = 0;
+    cache_seed = seed;
+    want_level = 0;
+    thread = lock && wake ? SDL_CreateThread(cache_worker, "waves", NULL) : NULL;
+    if (!thread) {
+        printf(" Warning: cache des vagues indisponible : %s\n", SDL_GetError());
+        wave_cache_stop();
+        return 0;
+    }
+    waves_set_cache(lookup);
+    return 1;
+}
+
+void wave_cache_stop(void) {
+    waves_set_cache(NULL);
+    if (thread) {
+        SDL_LockMutex(lock);
+        quit = 1;
+        SDL_SignalCondition(wake);
+        SDL_UnlockMutex(lock);
+        SDL_WaitThread(thread, NULL);
+        thread = NULL;
+    }
+    SDL_DestroyCondition(wake);
+    SDL_DestroyMutex(lock);
+    wake = NULL;
+    lock = NULL;
+    cache_seed = 0;
+    memset(slots, 0, sizeof(slots));
+}
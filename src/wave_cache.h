@@ -0,0 +1,23 @@
+/**
+ * @file wave_cache.h
+ * @brief Cache d'anticipation des vagues procédurales : un thread de fond génère les niveaux à venir.
+ * @details Chaque vague demandée (spawn_wave) fait préparer les WAVE_CACHE_LOOKAHEAD niveaux suivants de la
+ *          même graine ; le passage de niveau n'est alors qu'une copie. Une vague absente du cache est
+ *          générée sur place : le résultat est identique, le cache ne change que le moment du calcul.
+ *          Le cache sert une seule graine, celle de la partie interactive : les autres graines (études,
+ *          parties parallèles) passent à côté sans déplacer l'anticipation. Les simulations du bot sur la
+ *          même graine ne font qu'avancer l'anticipation vers des niveaux que la partie atteindra aussi.
+ */
+
+#ifndef WAVE_CACHE_H
+#define WAVE_CACHE_H
+
+#include <stdint.h>
+
+#define WAVE_CACHE_LOOKAHEAD 4
+
+// Démarre le thread pour la graine `seed` et branche le cache sur waves_spawn_generated ; 0 si le thread n'a pas pu être créé
+int wave_cache_start(uint64_t seed);
+void wave_cache_stop(void);
+
+#endif
@@ -0,0 +1,157 @@
+/**
+ * @file waves.c
+ * @brief Table des niveaux installée (fichier compilé, ou formation d'origine intégrée).
+ */
+
+#include <string.h>
+#include "waves.h"
+
+_Static_assert(sizeof(WaveFileHeader) == 32 && sizeof(WaveEnemyType) == 8 && sizeof(WaveLevel) == 16,
+               "Les structures de la table des niveaux font partie du format de fichier");
+
+// Formation d'origine : 10 x 3 ennemis espacés de 60 x 50 px, couleurs alternées par colonne
+#define BUILTIN_ENEMY(c, r) { { (GAME_WIDTH - 540) / 2 + (c) * 60, 50 + (r) * 50 }, (c) % 2, 1, { 0 } }
+#define BUILTIN_ROW(r) BUILTIN_ENEMY(0, r), BUILTIN_ENEMY(1, r), BUILTIN_ENEMY(2, r), BUILTIN_ENEMY(3, r), BUILTIN_ENEMY(4, r), \
+                       BUILTIN_ENEMY(5, r), BUILTIN_ENEMY(6, r), BUILTIN_ENEMY(7, r), BUILTIN_ENEMY(8, r), BUILTIN_ENEMY(9, r)
+
+static const Enemy builtin_enemies[] = { BUILTIN_ROW(0), BUILTIN_ROW(1), BUILTIN_ROW(2) };
+static const WaveEnemyType builtin_types[] = { { 10, 1.0f }, { 10, 1.0f } };
+static const WaveLevel builtin_level = { 0, sizeof(builtin_enemies) / sizeof(Enemy), 1.0f, 1.0f };
+
+static const WaveEnemyType* types = builtin_types;
+static const WaveLevel* levels = &builtin_level;
+static const Enemy* enemies = builtin_enemies;
+static uint32_t type_count = 2, level_count = 1;
+static uint64_t table_hash = 0;
+
+uint64_t fnv1a(uint64_t h, const void* data, size_t size) {
+    const unsigned char* p = data;
+    for (size_t i = 0; i < size; i++) { h ^= p[i]; h *= 0x100000001B3ull; }
+    return h;
+}
+
+int waves_set(const void* data, size_t size) {
+    if (!data) {
+        types = builtin_types; levels = &builtin_level; enemies = builtin_enemies;
+        type_count = 2; level_count = 1; table_hash = 0;
+        return 1;
+    }
+    const WaveFileHeader* h = data;
+    if (size < sizeof(*h) || h->magic != WAVES_MAGIC || h->version != WAVES_VERSION || h->enemy_size != sizeof(Enemy)
+        || h->type_count == 0 || h->type_count > WAVES_MAX_TYPES || h->level_count == 0) return 0;
+    uint64_t expected = sizeof(*h) + (uint64_t)h->type_count * sizeof(WaveEnemyType) + (uint64_t)h->level_count * sizeof(WaveLevel)
+                      + (uint64_t)h->enemy_total * sizeof(Enemy);
+    if (expected != size || fnv1a(FNV1A_OFFSET, (const unsigned char*)data + sizeof(*h), size - sizeof(*h)) != h->hash) return 0;
+
+    const WaveEnemyType* t = (const WaveEnemyType*)(h + 1);
+    const WaveLevel* l = (const WaveLevel*)(t + h->type_count);
+    const Enemy* e = (const Enemy*)(l + h->level_count);
+    for (uint32_t i = 0; i < h->level_count; i++) {
+        if (l[i].enemy_count == 0 || l[i].enemy_count > MAX_ENEMIES || l[i].first_enemy > h->enemy_total
+            || l[i].enemy_count > h->enemy_total - l[i].first_enemy) return 0;
+    }
+    for (uint32_t i = 0; i < h->enemy_total; i++) if (e[i].type < 0 || (uint32_t)e[i].type >= h->type_count) return 0;
+
+    types = t; levels = l; enemies = e;
+    type_count = h->type_count; level_count = h->level_count; table_hash = h->hash;
+    return 1;
+}
+
+const WaveLevel* waves_level(int level) {
+    uint32_t i = level < 1 ? 0 : (uint32_t)(level - 1);
+    return &levels[i < level_count ? i : level_count - 1];
+}
+
+const Enemy* waves_enemies(const WaveLevel* level) { return enemies + level->first_enemy; }
+
+const WaveEnemyType* waves_type(int type) { return &types[(uint32_t)type < type_count ? (uint32_t)type : 0]; }
+
+int waves_level_count(void) { return (int)level_count; }
+
+uint64_t waves_hash(void) { return table_hash; }
+
+// --- NIVEAUX PROCÉDURAUX ---
+
+#define GEN_MARGIN 40          // Marge horizontale de la formation à l'apparition
+#define GEN_TOP 50
+#define GEN_BOTTOM 320         // Limite basse de la formation à l'apparition
+#define GEN_MAX_COLS 20
+#define GEN_MAX_ROWS 8
+
+typedef enum { SHAPE_FULL, SHAPE_CHECKER, SHAPE_PYRAMID, SHAPE_DIAMOND, SHAPE_SQUADS, SHAPE_HOLES, SHAPE_COUNT } GenShape;
+
+static WaveCacheLookup cache_lookup = NULL;
+
+static uint64_t gen_next(uint64_t* state) {
+    uint64_t z = (*state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+static int gen_range(uint64_t* rng, int n) { return (int)(gen_next(rng) % (uint64_t)n); }
+
+void waves_generated_scales(int level, float* speed_scale, float* fire_scale) {
+    int d = level > 1 ? level - 1 : 0;
+    *speed_scale = 1.0f + 0.04f * (d < 40 ? d : 40);
+    *fire_scale = 1.0f + 0.06f * (d < 50 ? d : 50);
+}
+
+static int shape_cell(GenShape shape, int r, int c, int rows, int cols, uint64_t* rng) {
+    int dc = 2 * c - (cols - 1), dr = 2 * r - (rows - 1); // Distances au centre (doublées)
+    if (dc < 0) dc = -dc;
+    if (dr < 0) dr = -dr;
+    switch (shape) {
+        case SHAPE_CHECKER: return (r + c) % 2 == 0;
+        case SHAPE_PYRAMID: return dc < cols * (r + 1) / rows + 1;
+        case SHAPE_DIAMOND: return dc * rows + dr * cols <= rows * cols;
+        case SHAPE_SQUADS: return c % 5 != 4;
+        case SHAPE_HOLES: return gen_range(rng, 100) < 75;
+        default: return 1;
+    }
+}
+
+/**
+ * @details La taille de la formation, la part d'ennemis des types supérieurs et les multiplicateurs
+ *          croissent avec le niveau ; la forme, les promotions et les variations de taille viennent du tirage.
+ *          Les types 0 et 1 (de base) alternent par colonne, les suivants occupent les rangées du haut.
+ */
+int waves_generate(uint64_t seed, int level, Enemy* enemies) {
+    uint64_t rng = seed ^ ((uint64_t)level * 0xD1B54A32D192ED03ull);
+    int d = level > 1 ? level - 1 : 0;
+    int cols = 8 + d / 2 + gen_range(&rng, 3) - 1, rows = 3 + d / 5;
+    if (cols > GEN_MAX_COLS) cols = GEN_MAX_COLS;
+    if (rows > GEN_MAX_ROWS) rows = GEN_MAX_ROWS;
+    while (rows * cols > MAX_ENEMIES) cols--;
+    GenShape shape = d < 2 ? SHAPE_FULL : (GenShape)gen_range(&rng, SHAPE_COUNT);
+
+    int dx = (GAME_WIDTH - 2 * GEN_MARGIN - ENEMY_W) / (cols - 1);
+    if (dx > 60) dx = 60;
+    int dy = rows > 1 ? (GEN_BOTTOM - GEN_TOP - ENEMY_H) / (rows - 1) : 50;
+    if (dy > 50) dy = 50;
+    int ox = (GAME_WIDTH - (cols - 1) * dx) / 2;
+
+    int top_type = (int)type_count - 1;              // Meilleur type disponible à ce niveau
+    if (top_type > 1 + d / 5) top_type = 1 + d / 5;
+    int promote = 5 + 2 * d < 40 ? 5 + 2 * d : 40;    // Pourcentage de promotions d'un type
+    int count = 0;
+    for (int pass = 0; pass < 2 && count == 0; pass++) { // Forme vide (improbable) : formation pleine
+        for (int r = 0; r < rows; r++) {
+            for (int c = 0; c < cols; c++) {
+                if (pass == 0 && !shape_cell(shape, r, c, rows, cols, &rng)) continue;
+                int type = top_type - r;
+                if (type < 2) type = type_count > 1 ? c % 2 : 0;
+                if (type < top_type && gen_range(&rng, 100) < promote) type = type < 2 ? (top_type >= 2 ? 2 : type) : type + 1;
+                enemies[count++] = (Enemy){ { ox + c * dx, GEN_TOP + r * dy }, type, 1, { 0 } };
+            }
+        }
+    }
+    return count;
+}
+
+void waves_set_cache(WaveCacheLookup lookup) { cache_lookup = lookup; }
+
+int waves_spawn_generated(uint64_t seed, int level, Enemy* enemies) {
+    int count = cache_lookup ? cache_lookup(seed, level, enemies) : 0;
+    return count ? count : waves_generate(seed, level, enemies);
+}
@@ -0,0 +1,84 @@
+/**
+ * @file waves.h
+ * @brief Table des niveaux : formations, types d'ennemis et réglages de chaque vague, au format binaire.
+ * @details Le fichier source (assets/waves.txt) est compilé par tools/wave_compiler en une table prête à
+ *          l'emploi : WaveFileHeader, WaveEnemyType[type_count], WaveLevel[level_count], puis les ennemis
+ *          de toutes les formations, stockés exactement comme dans GameState. La table est lue en place
+ *          (bundle mappé ou embarqué) : faire apparaître une vague est un memcpy, sans analyse.
+ *          Sans table chargée, la formation d'origine (10 x 3) sert à tous les niveaux.
+ *          Avec GameRules.wave_seed non nul, les niveaux sont plutôt produits par un générateur procédural :
+ *          fonction pure de (graine, niveau), donc rejouable ; un cache d'anticipation facultatif
+ *          (wave_cache.h) prépare les vagues suivantes sur un thread de fond.
+ */
+
+#ifndef WAVES_H
+#define WAVES_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "model.h"
+
+#define WAVES_FILE "waves.bin"      // Nom de l'entrée dans le bundle
+#define WAVES_MAGIC 0x31565749u     // "IWV1"
+#define WAVES_VERSION 1
+#define WAVES_MAX_TYPES 8
+
+// Empreinte FNV-1a 64 bits, chaînable (partir de FNV1A_OFFSET) : tables compilées, replays, états du modèle
+#define FNV1A_OFFSET 0xCBF29CE484222325ull
+uint64_t fnv1a(uint64_t h, const void* data, size_t size);
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t enemy_size;            // sizeof(Enemy) à la compilation
+    uint32_t type_count;
+    uint32_t level_count;
+    uint32_t enemy_total;
+    uint64_t hash;                  // FNV-1a du reste du fichier (enregistré dans les replays)
+} WaveFileHeader;
+
+typedef struct {
+    int32_t points;                 // Score gagné en détruisant cet ennemi
+    float fire_scale;               // Multiplie les chances de tir (GameRules.enemy_shot_chance)
+} WaveEnemyType;
+
+typedef struct {
+    uint32_t first_enemy;           // Indice de la formation dans la table des ennemis
+    uint32_t enemy_count;
+    float speed_scale;              // Multiplie GameRules.enemy_speed
+    float fire_scale;               // Multiplie GameRules.enemy_shot_chance
+} WaveLevel;
+
+/**
+ * @brief Vérifie et installe une table (non copiée : data doit rester valide) ; NULL rétablit la formation d'origine.
+ * @return 1 si la table est installée, 0 si elle est invalide (la précédente est conservée).
+ */
+int waves_set(const void* data, size_t size);
+
+// Niveau `level` (1 = premier) ; au-delà de la table, le dernier niveau se répète
+const WaveLevel* waves_level(int level);
+const Enemy* waves_enemies(const WaveLevel* level);
+const WaveEnemyType* waves_type(int type);
+int waves_level_count(void);
+uint64_t waves_hash(void);          // Empreinte de la table installée (0 : formation d'origine)
+
+// --- NIVEAUX PROCÉDURAUX ---
+
+// Formation du niveau `level` pour la graine `seed` (ennemis dans enemies[MAX_ENEMIES]) ; renvoie le nombre d'ennemis,
+// plafonné à MAX_ENEMIES (128) comme les niveaux de la table : la formation cesse de grandir au-delà
+int waves_generate(uint64_t seed, int level, Enemy* enemies);
+
+// Multiplicateurs de vitesse et de tir d'un niveau procédural (ne dépendent que du niveau)
+void waves_generated_scales(int level, float* speed_scale, float* fire_scale);
+
+/**
+ * @brief Source de vagues déjà générées (cache d'anticipation) : copie la vague et renvoie son nombre
+ *        d'ennemis, ou 0 si elle n'est pas prête (elle est alors générée sur place).
+ */
+typedef int (*WaveCacheLookup)(uint64_t seed, int level, Enemy* enemies);
+void waves_set_cache(WaveCacheLookup lookup);
+
+// Vague procédurale : depuis le cache s'il la contient, sinon générée immédiatement (même résultat)
+int waves_spawn_generated(uint64_t seed, int level, Enemy* enemies);
+
+#endif
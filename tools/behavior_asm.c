@@ -0,0 +1,191 @@
+/**
+ * @file behavior_asm.c
+ * @brief Outil de build : assemble les programmes de comportement des ennemis en table binaire (voir src/behavior.h).
+ * @details Usage : behavior_asm <comportements.s> <sortie.bin>
+ *          Syntaxe (une directive ou instruction par ligne, '#' ou ';' commente la fin de ligne) :
+ *            program <nom>                 commence un programme (END est ajouté à sa fin)
+ *            <étiquette>:                  cible de saut, vers l'avant uniquement
+ *            <op> [opérandes]              mov a b | add/sub/mul/min/max a b c | abs a b | roll a | fire | end
+ *                                          jmp L | jlt b c L | jge b c L
+ *            bind <type> <nom>             programme du type d'ennemi (par défaut : le premier programme)
+ *          Les opérandes sont des registres (x y dx px chance level p0..p3 t0..t5) ou des nombres,
+ *          placés dans les constantes du programme. Les virgules sont facultatives.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "behavior.h"
+
+#define MAX_LABELS 64
+#define MAX_FIXUPS 128
+
+typedef struct { char name[32]; int pc; } Label;
+typedef struct { char name[32]; int pc; int line; } Fixup; // Saut dont la cible n'est pas encore connue
+
+static const char* reg_names[BEHAVIOR_REGS] = { "x", "y", "dx", "px", "chance", "level", "p0", "p1", "p2", "p3",
+                                                "t0", "t1", "t2", "t3", "t4", "t5" };
+static const char* op_names[OP_COUNT] = { "end", "mov", "add", "sub", "mul", "min", "max", "abs",
+                                          "jmp", "jlt", "jge", "roll", "fire" };
+
+static BehaviorProgram programs[BEHAVIOR_MAX_PROGRAMS];
+static char program_names[BEHAVIOR_MAX_PROGRAMS][32];
+static int program_count = 0;
+static uint32_t code[BEHAVIOR_MAX_PROGRAMS * BEHAVIOR_MAX_CODE];
+static uint32_t code_words = 0;
+static float consts[BEHAVIOR_MAX_PROGRAMS * BEHAVIOR_MAX_CONSTS];
+static uint32_t const_count = 0;
+static uint8_t type_program[WAVES_MAX_TYPES];
+static Label labels[MAX_LABELS];
+static Fixup fixups[MAX_FIXUPS];
+static int label_count = 0, fixup_count = 0;
+static const char* source = NULL;
+
+static int fail(int line, const char* message) {
+    fprintf(stderr, "%s:%d : %s\n", source, line, message);
+    return 0;
+}
+
+// Registre ou constante (dédupliquée dans le programme courant) ; -1 si l'opérande est invalide
+static int operand(const char* token, int writable) {
+    for (int r = 0; r < BEHAVIOR_REGS; r++) if (strcmp(token, reg_names[r]) == 0) return r;
+    char* end;
+    float value = strtof(token, &end);
+    if (writable || end == token || *end) return -1;
+    BehaviorProgram* p = &programs[program_count - 1];
+    for (int k = 0; k < p->const_count; k++) if (consts[p->first_const + k] == value) return BEHAVIOR_REGS + k;
+    if (p->const_count == BEHAVIOR_MAX_CONSTS) return -1;
+    consts[const_count++] = value;
+    return BEHAVIOR_REGS + p->const_count++;
+}
+
+static int emit(int line, uint32_t word) {
+    BehaviorProgram* p = &programs[program_count - 1];
+    if (p->word_count == BEHAVIOR_MAX_CODE - 1) return fail(line, "programme trop long"); // Place du END final
+    code[code_words++] = word;
+    p->word_count++;
+    return 1;
+}
+
+// Termine le programme courant : END final, résolution des sauts
+static int finish_program(void) {
+    if (program_count == 0) return 1;
+    BehaviorProgram* p = &programs[program_count - 1];
+    code[code_words++] = BEHAVIOR_OP(OP_END, 0, 0, 0);
+    p->word_count++;
+    for (int f = 0; f < fixup_count; f++) {
+        int target = -1;
+        for (int l = 0; l < label_count; l++) if (strcmp(labels[l].name, fixups[f].name) == 0) target = labels[l].pc;
+        if (target < 0) return fail(fixups[f].line, "étiquette inconnue");
+        int offset = target - (fixups[f].pc + 1);
+        if (offset < 0) return fail(fixups[f].line, "saut vers l'arrière interdit");
+        if (offset > 127) return fail(fixups[f].line, "saut trop long (127 instructions)");
+        code[p->first_word + fixups[f].pc] |= (uint32_t)offset << 8;
+    }
+    label_count = fixup_count = 0;
+    return 1;
+}
+
+static int assemble(FILE* in) {
+    char buffer[256];
+    int line = 0;
+    while (fgets(buffer, sizeof(buffer), in)) {
+        line++;
+        buffer[strcspn(buffer, "#;")] = '\0';
+        char* tokens[8];
+        int n = 0;
+        for (char* t = strtok(buffer, " \t\r\n,"); t && n < 8; t = strtok(NULL, " \t\r\n,")) tokens[n++] = t;
+        if (n == 0) continue;
+
+        size_t len = strlen(tokens[0]);
+        if (strcmp(tokens[0], "program") == 0) {
+            if (n != 2 || strlen(tokens[1]) >= 32) return fail(line, "program <nom>");
+            if (!finish_program()) return 0;
+            if (program_count == BEHAVIOR_MAX_PROGRAMS) return fail(line, "trop de programmes");
+            for (int i = 0; i < program_count; i++) if (strcmp(program_names[i], tokens[1]) == 0) return fail(line, "programme déjà défini");
+            strcpy(program_names[program_count], tokens[1]);
+            programs[program_count++] = (BehaviorProgram){ (uint16_t)code_words, 0, (uint16_t)const_count, 0 };
+        } else if (strcmp(tokens[0], "bind") == 0) {
+            int type = n == 3 ? atoi(tokens[1]) : -1, program = -1;
+            if (type < 0 || type >= WAVES_MAX_TYPES) return fail(line, "bind <type> <programme>");
+            for (int i = 0; i < program_count; i++) if (strcmp(program_names[i], tokens[2]) == 0) program = i;
+            if (program < 0) return fail(line, "programme inconnu (à définir avant bind)");
+            type_program[type] = (uint8_t)program;
+        } else if (program_count == 0) {
+            return fail(line, "instruction hors d'un programme");
+        } else if (tokens[0][len - 1] == ':') {
+            if (n != 1 || len > 32 || label_count == MAX_LABELS) return fail(line, "étiquette invalide");
+            tokens[0][len - 1] = '\0';
+            for (int l = 0; l < label_count; l++) if (strcmp(labels[l].name, tokens[0]) == 0) return fail(line, "étiquette déjà définie");
+            strcpy(labels[label_count].name, tokens[0]);
+            labels[label_count++].pc = programs[program_count - 1].word_count;
+        } else {
+            int op = -1;
+            for (int i = 0; i < OP_COUNT; i++) if (strcmp(tokens[0], op_names[i]) == 0) op = i;
+            int a = 0, b = 0, c = 0, ok = 1;
+            const char* target = NULL;
+            switch (op) {
+                case OP_END: case OP_FIRE: ok = n == 1; break;
+                case OP_ROLL: ok = n == 2 && (a = operand(tokens[1], 1)) >= 0; break;
+                case OP_MOV: case OP_ABS: ok = n == 3 && (a = operand(tokens[1], 1)) >= 0 && (b = operand(tokens[2], 0)) >= 0; break;
+                case OP_ADD: case OP_SUB: case OP_MUL: case OP_MIN: case OP_MAX:
+                    ok = n == 4 && (a = operand(tokens[1], 1)) >= 0 && (b = operand(tokens[2], 0)) >= 0 && (c = operand(tokens[3], 0)) >= 0;
+                    break;
+                case OP_JMP: ok = n == 2; target = tokens[1]; break;
+                case OP_JLT: case OP_JGE:
+                    ok = n == 4 && (b = operand(tokens[1], 0)) >= 0 && (c = operand(tokens[2], 0)) >= 0;
+                    target = tokens[3];
+                    break;
+                default: return fail(line, "instruction inconnue");
+            }
+            if (!ok) return fail(line, "opérandes invalides (registre écrit, registre ou nombre lus, étiquette)");
+            if (target) {
+                if (fixup_count == MAX_FIXUPS || strlen(target) >= 32) return fail(line, "trop de sauts");
+                strcpy(fixups[fixup_count].name, target);
+                fixups[fixup_count].pc = programs[program_count - 1].word_count;
+                fixups[fixup_count++].line = line;
+            }
+            if (!emit(line, BEHAVIOR_OP(op, a, b, c))) return 0;
+        }
+    }
+    if (!finish_program()) return 0;
+    if (program_count == 0) return fail(line, "aucun programme");
+    return 1;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc != 3) {
+        fprintf(stderr, "Usage : %s <comportements.s> <sortie.bin>\n", argv[0]);
+        return 1;
+    }
+    source = argv[1];
+    FILE* in = fopen(argv[1], "r");
+    if (!in) { perror(argv[1]); return 1; }
+    int ok = assemble(in);
+    fclose(in);
+    if (!ok) return 1;
+
+    BehaviorFileHeader header = { BEHAVIOR_MAGIC, BEHAVIOR_VERSION, (uint32_t)program_count, code_words, const_count, 0, {0}, 0 };
+    memcpy(header.type_program, type_program, sizeof(type_program));
+    header.hash = fnv1a(FNV1A_OFFSET, type_program, sizeof(type_program));
+    header.hash = fnv1a(header.hash, programs, program_count * sizeof(BehaviorProgram));
+    header.hash = fnv1a(header.hash, code, code_words * sizeof(uint32_t));
+    header.hash = fnv1a(header.hash, consts, const_count * sizeof(float));
+
+    size_t size = sizeof(header) + program_count * sizeof(BehaviorProgram) + code_words * sizeof(uint32_t) + const_count * sizeof(float);
+    unsigned char* table = malloc(size);
+    if (!table) return 1;
+    unsigned char* p = table;
+    memcpy(p, &header, sizeof(header)); p += sizeof(header);
+    memcpy(p, programs, program_count * sizeof(BehaviorProgram)); p += program_count * sizeof(BehaviorProgram);
+    memcpy(p, code, code_words * sizeof(uint32_t)); p += code_words * sizeof(uint32_t);
+    memcpy(p, consts, const_count * sizeof(float));
+    if (!behavior_set(table, size)) { fprintf(stderr, "Table produite invalide\n"); return 1; } // Même contrôle qu'au chargement
+
+    FILE* out = fopen(argv[2], "wb");
+    if (!out || fwrite(table, 1, size, out) != size) { fprintf(stderr, "Impossible d'écrire %s\n", argv[2]); return 1; }
+    fclose(out);
+    printf("Comportements %s : %d programmes, %u instructions, %u constantes, %zu octets\n", argv[2], program_count, code_words, const_count, size);
+    free(table);
+    return 0;
+}
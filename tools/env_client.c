@@ -0,0 +1,58 @@
+/**
+ * @file env_client.c
+ * @brief Client d'exemple de l'environnement en mémoire partagée : actions aléatoires, mesure du débit.
+ * @details Usage : env_client <nom> [steps]  (serveur lancé avec ./jeu --env <nom> --envs N [--pixels 84])
+ */
+
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "shm_env.h"
+#include "model.h"
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        fprintf(stderr, "Usage : %s <nom> [steps]\n", argv[0]);
+        return 1;
+    }
+    long steps = argc > 2 ? atol(argv[2]) : 10000;
+
+    ShmEnvHeader* env = NULL;
+    for (int tries = 0; tries < 100 && !(env = shm_env_attach(argv[1])); tries++) {
+        struct timespec ts = {0, 50 * 1000000L};
+        nanosleep(&ts, NULL); // Le serveur n'a peut-être pas fini d'initialiser le segment
+    }
+    if (!env) {
+        fprintf(stderr, "Segment %s introuvable ou incompatible\n", argv[1]);
+        return 1;
+    }
+
+    unsigned char* base = (unsigned char*)env;
+    int32_t* actions = (int32_t*)(base + env->actions_offset);
+    const float* rewards = (const float*)(base + env->rewards_offset);
+    const uint8_t* dones = base + env->dones_offset;
+    const GameState* states = (const GameState*)(base + env->states_offset);
+    int n = env->num_envs;
+
+    shm_env_call(env, SHM_ENV_CMD_RESET);
+    srand(1);
+    double total_reward = 0;
+    long episodes = 0;
+    struct timespec t0, t1;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (long s = 0; s < steps; s++) {
+        for (int i = 0; i < n; i++) actions[i] = rand() % INV_ACTION_COUNT;
+        shm_env_call(env, SHM_ENV_CMD_STEP);
+        for (int i = 0; i < n; i++) { total_reward += rewards[i]; episodes += dones[i]; }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    double elapsed = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9;
+
+    printf("%ld steps x %d parties en %.2f s : %.0f ticks/s\n", steps, n, elapsed, steps * n / elapsed);
+    printf("Récompense totale %.0f, %ld parties terminées, niveau partie 0 : %d\n", total_reward, episodes, states[0].level);
+
+    shm_env_call(env, SHM_ENV_CMD_CLOSE);
+    shm_env_detach(env);
+    return 0;
+}
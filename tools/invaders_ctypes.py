@@ -0,0 +1,106 @@
+#!/usr/bin/env python3
+"""Exemple d'utilisation de libinvaders.so depuis Python (ctypes, sans dépendance).
+
+Usage : python3 tools/invaders_ctypes.py [libinvaders.so] [parties] [ticks] [assets.bundle]
+Construit la bibliothèque avec `make lib`. Un seul appel inv_step avance toutes les parties de
+plusieurs ticks ; actions, récompenses et fins de partie sont des buffers possédés par Python.
+La table des niveaux et les comportements sont lus dans le bundle du jeu (make bundle) : sans
+eux, la bibliothèque joue les règles intégrées, pas le jeu de ./jeu.
+"""
+
+import ctypes
+import os
+import random
+import struct
+import sys
+import time
+
+ABI_VERSION = 4
+FEATURE_SIZE = 9 + 128 * 4 + 10 * 3 + 10 * 3 + 4
+ACTION_COUNT = 6
+BUNDLE_MAGIC = 0x4E424953
+
+
+def bundle_entries(path):
+    """Entrées du bundle (voir src/bundle.h) : nom -> octets."""
+    with open(path, "rb") as f:
+        data = f.read()
+    magic, _, count, _ = struct.unpack_from("<4I", data, 0)
+    assert magic == BUNDLE_MAGIC, "bundle invalide"
+    entries = {}
+    for i in range(count):
+        name, offset, size = struct.unpack_from("<32sQQ", data, 16 + i * 48)
+        entries[name.split(b"\0")[0].decode()] = data[offset:offset + size]
+    return entries
+
+
+def load_tables(lib, bundle_path):
+    """Installe les tables du bundle et vérifie que la bibliothèque joue bien celles-ci (empreintes)."""
+    entries = bundle_entries(bundle_path)
+    waves, behaviors = entries["waves.bin"], entries["behaviors.bin"]
+    assert lib.inv_load_tables(waves, len(waves), behaviors, len(behaviors)), "tables refusées"
+    waves_hash, behaviors_hash = ctypes.c_uint64(), ctypes.c_uint64()
+    lib.inv_table_hashes(ctypes.byref(waves_hash), ctypes.byref(behaviors_hash))
+    # Empreintes dans les en-têtes : WaveFileHeader.hash (octet 24), BehaviorFileHeader.hash (octet 32)
+    assert waves_hash.value == struct.unpack_from("<Q", waves, 24)[0], "table des niveaux différente"
+    assert behaviors_hash.value == struct.unpack_from("<Q", behaviors, 32)[0], "comportements différents"
+
+
+def load(path):
+    lib = ctypes.CDLL(path)
+    lib.inv_create.restype = ctypes.c_void_p
+    lib.inv_create.argtypes = [ctypes.c_int]
+    lib.inv_destroy.argtypes = [ctypes.c_void_p]
+    lib.inv_step.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_int32), ctypes.c_int,
+                             ctypes.POINTER(ctypes.c_float), ctypes.POINTER(ctypes.c_uint8)]
+    lib.inv_observe_features.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_float)]
+    lib.inv_set_pixel_observation.argtypes = [ctypes.c_void_p, ctypes.c_int, ctypes.c_int, ctypes.c_int]
+    lib.inv_observe_pixels.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint8)]
+    lib.inv_load_tables.argtypes = [ctypes.c_char_p, ctypes.c_size_t, ctypes.c_char_p, ctypes.c_size_t]
+    lib.inv_table_hashes.argtypes = [ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(ctypes.c_uint64)]
+    return lib
+
+
+def main():
+    path = sys.argv[1] if len(sys.argv) > 1 else "./libinvaders.so"
+    envs = int(sys.argv[2]) if len(sys.argv) > 2 else 256
+    ticks = int(sys.argv[3]) if len(sys.argv) > 3 else 1000
+    bundle = sys.argv[4] if len(sys.argv) > 4 else "assets.bundle"
+
+    lib = load(path)
+    assert lib.inv_abi_version() == ABI_VERSION, "version d'ABI inattendue"
+    if os.path.exists(bundle):
+        load_tables(lib, bundle)
+    else:
+        print(f"{bundle} absent : règles intégrées (formation d'origine), différentes de ./jeu")
+    env = lib.inv_create(envs)
+    lib.inv_set_pixel_observation(env, 84, 84, 1)
+
+    batch = 100  # Ticks par appel
+    actions = (ctypes.c_int32 * (batch * envs))()
+    rewards = (ctypes.c_float * (batch * envs))()
+    dones = (ctypes.c_uint8 * (batch * envs))()
+    features = (ctypes.c_float * (envs * FEATURE_SIZE))()
+    pixels = (ctypes.c_uint8 * (envs * 84 * 84))()
+
+    random.seed(1)
+    total_reward, episodes = 0.0, 0
+    start = time.perf_counter()
+    for _ in range(ticks // batch):
+        for i in range(batch * envs):
+            actions[i] = random.randrange(ACTION_COUNT)
+        lib.inv_step(env, actions, batch, rewards, dones)
+        total_reward += sum(rewards)
+        episodes += sum(dones)
+    elapsed = time.perf_counter() - start
+    lib.inv_observe_features(env, features)
+    lib.inv_observe_pixels(env, pixels)
+
+    print(f"{ticks // batch * batch} ticks x {envs} parties en {elapsed:.2f} s (actions tirées en Python comprises)")
+    print(f"récompense totale {total_reward:.0f}, {episodes} parties terminées, "
+          f"joueur 0 en x={features[0]:.0f}, score {features[4]:.0f}")
+    lib.inv_destroy(env)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,98 @@
+/**
+ * @file pack_assets.c
+ * @brief Outil de build : regroupe les WAV et l'atlas pré-calculé dans un bundle unique.
+ * @details Usage : pack_assets <sortie.bundle> <fichier1.wav> [fichier2.wav ...]
+ *          Chaque entrée est alignée sur BUNDLE_ALIGN octets pour être utilisable directement après mmap.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bundle.h"
+#include "sprites.h"
+
+typedef struct { const char* name; unsigned char* data; size_t size; } PackEntry;
+
+static unsigned char* read_file(const char* path, size_t* size) {
+    FILE* f = fopen(path, "rb");
+    if (!f) return NULL;
+    fseek(f, 0, SEEK_END);
+    long len = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    unsigned char* data = malloc(len > 0 ? len : 1);
+    if (data && fread(data, 1, len, f) != (size_t)len) { free(data); data = NULL; }
+    fclose(f);
+    *size = len;
+    return data;
+}
+
+static size_t align_up(size_t v) {
+    return (v + BUNDLE_ALIGN - 1) & ~(size_t)(BUNDLE_ALIGN - 1);
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        fprintf(stderr, "Usage : %s <sortie.bundle> <fichiers...>\n", argv[0]);
+        return 1;
+    }
+
+    int count = argc - 2 + 1; // Fichiers + atlas
+    PackEntry* entries = calloc(count, sizeof(PackEntry));
+    if (!entries) return 1;
+
+    for (int i = 2; i < argc; i++) {
+        PackEntry* e = &entries[i - 2];
+        const char* slash = strrchr(argv[i], '/');
+        e->name = slash ? slash + 1 : argv[i];
+        if (strlen(e->name) >= BUNDLE_NAME_MAX) {
+            fprintf(stderr, "Nom trop long : %s\n", e->name);
+            return 1;
+        }
+        e->data = read_file(argv[i], &e->size);
+        if (!e->data) {
+            fprintf(stderr, "Impossible de lire %s\n", argv[i]);
+            return 1;
+        }
+    }
+
+    PackEntry* atlas = &entries[count - 1];
+    atlas->name = "atlas";
+    atlas->size = sprites_atlas_size();
+    atlas->data = malloc(atlas->size);
+    if (!atlas->data) return 1;
+    sprites_bake_atlas(atlas->data);
+
+    BundleHeader header = { BUNDLE_MAGIC, BUNDLE_VERSION, (uint32_t)count, 0 };
+    BundleEntry* table = calloc(count, sizeof(BundleEntry));
+    if (!table) return 1;
+    size_t offset = align_up(sizeof(BundleHeader) + count * sizeof(BundleEntry));
+    for (int i = 0; i < count; i++) {
+        snprintf(table[i].name, BUNDLE_NAME_MAX, "%s", entries[i].name);
+        table[i].offset = offset;
+        table[i].size = entries[i].size;
+        offset = align_up(offset + entries[i].size);
+    }
+
+    FILE* out = fopen(argv[1], "wb");
+    if (!out) {
+        fprintf(stderr, "Impossible d'écrire %s\n", argv[1]);
+        return 1;
+    }
+    static const unsigned char zeros[BUNDLE_ALIGN] = {0};
+    size_t written = 0;
+    written += fwrite(&header, 1, sizeof(header), out);
+    written += fwrite(table, 1, count * sizeof(BundleEntry), out);
+    for (int i = 0; i < count; i++) {
+        fwrite(zeros, 1, table[i].offset - written, out);
+        written = table[i].offset;
+        written += fwrite(entries[i].data, 1, entries[i].size, out);
+    }
+    fwrite(zeros, 1, align_up(written) - written, out);
+    fclose(out);
+
+    printf("Bundle %s : %d entrées, %zu octets\n", argv[1], count, align_up(written));
+    for (int i = 0; i < count; i++) free(entries[i].data);
+    free(entries);
+    free(table);
+    return 0;
+}
@@ -0,0 +1,141 @@
+/**
+ * @file verify_replays.c
+ * @brief Vérifie un dossier de replays soumis : re-simulation headless sur tous les cœurs.
+ * @details Usage : verify-replays <dossier> [-o resultats.csv] [-j threads]
+ *          Chaque fichier .replay est rejoué depuis sa graine (replay_verify) ; score, niveau et empreinte
+ *          de l'état final doivent correspondre à l'en-tête, de même que les niveaux et les comportements (ceux du bundle).
+ *          Les threads se partagent les fichiers par un compteur atomique ; le CSV est trié par nom de fichier.
+ *          Code de retour 1 si un replay est rejeté.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+#include <SDL3/SDL.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dirent.h>
+#include "replay.h"
+#include "waves.h"
+#include "behavior.h"
+#include "bundle.h"
+
+#define MAX_THREADS 256
+
+typedef struct {
+    char* name;
+    ReplayVerdict verdict;
+    int readable;
+    uint64_t ticks;
+    int score, level;
+    uint64_t hash;
+} Entry;
+
+typedef struct {
+    const char* dir;
+    Entry* entries;
+    int count;
+    SDL_AtomicInt next;
+} Job;
+
+static int compare_entries(const void* a, const void* b) {
+    return strcmp(((const Entry*)a)->name, ((const Entry*)b)->name);
+}
+
+static int has_suffix(const char* s, const char* suffix) {
+    size_t n = strlen(s), m = strlen(suffix);
+    return n >= m && strcmp(s + n - m, suffix) == 0;
+}
+
+static int SDLCALL verify_worker(void* data) {
+    Job* job = (Job*)data;
+    char path[4096];
+    GameState state = {0};
+    int i;
+    while ((i = SDL_AddAtomicInt(&job->next, 1)) < job->count) {
+        Entry* e = &job->entries[i];
+        snprintf(path, sizeof(path), "%s/%s", job->dir, e->name);
+        Replay* r = replay_open(path);
+        if (!r) continue; // readable reste à 0
+        e->readable = 1;
+        e->verdict = replay_verify(r, &state);
+        e->ticks = replay_header(r)->tick_count;
+        e->score = state.score;
+        e->level = state.level;
+        e->hash = model_hash(&state);
+        replay_close(r);
+    }
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    const char* dir = NULL;
+    const char* out_path = "verified_replays.csv";
+    int threads = SDL_GetNumLogicalCPUCores();
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) out_path = argv[++i];
+        else if (strcmp(argv[i], "-j") == 0 && i + 1 < argc) threads = atoi(argv[++i]);
+        else dir = argv[i];
+    }
+    if (!dir) {
+        fprintf(stderr, "Usage : %s <dossier> [-o resultats.csv] [-j threads]\n", argv[0]);
+        return 1;
+    }
+    if (threads < 1) threads = 1;
+
+    // Mêmes niveaux et comportements que le jeu (bundle), sans quoi les replays récents sont rejetés ("niveaux", "comportements")
+    size_t waves_size = 0;
+    const void* waves = bundle_get(WAVES_FILE, &waves_size);
+    if (waves && !waves_set(waves, waves_size)) fprintf(stderr, "Table des niveaux invalide, formation d'origine utilisée\n");
+    size_t behaviors_size = 0;
+    const void* behaviors = bundle_get(BEHAVIOR_FILE, &behaviors_size);
+    if (behaviors && !behavior_set(behaviors, behaviors_size)) fprintf(stderr, "Comportements invalides, formation d'origine utilisée\n");
+    if (threads > MAX_THREADS) threads = MAX_THREADS;
+
+    DIR* d = opendir(dir);
+    if (!d) { perror(dir); return 1; }
+    Job job = { dir, NULL, 0, {0} };
+    int capacity = 0;
+    struct dirent* ent;
+    while ((ent = readdir(d))) {
+        if (!has_suffix(ent->d_name, ".replay")) continue;
+        if (job.count == capacity) {
+            capacity = capacity ? capacity * 2 : 1024;
+            Entry* grown = realloc(job.entries, capacity * sizeof(Entry));
+            if (!grown) { fprintf(stderr, "Mémoire insuffisante\n"); closedir(d); return 1; }
+            job.entries = grown;
+        }
+        job.entries[job.count++] = (Entry){ strdup(ent->d_name), REPLAY_BAD_INPUTS, 0, 0, 0, 0, 0 };
+    }
+    closedir(d);
+    qsort(job.entries, job.count, sizeof(Entry), compare_entries);
+
+    Uint64 start = SDL_GetPerformanceCounter();
+    SDL_Thread* workers[MAX_THREADS] = {0};
+    for (int i = 1; i < threads; i++) workers[i] = SDL_CreateThread(verify_worker, "verify", &job);
+    verify_worker(&job); // Le thread principal vérifie aussi
+    for (int i = 1; i < threads; i++) if (workers[i]) SDL_WaitThread(workers[i], NULL);
+    double seconds = (SDL_GetPerformanceCounter() - start) / (double)SDL_GetPerformanceFrequency();
+
+    FILE* out = fopen(out_path, "w");
+    if (!out) { perror(out_path); return 1; }
+    fprintf(out, "file,status,ticks,score,level,hash\n");
+    int valid = 0;
+    uint64_t total_ticks = 0;
+    for (int i = 0; i < job.count; i++) {
+        Entry* e = &job.entries[i];
+        const char* status = e->readable ? replay_verdict_name(e->verdict) : "illisible";
+        fprintf(out, "%s,%s,%llu,%d,%d,%016llx\n", e->name, status, (unsigned long long)e->ticks, e->score, e->level,
+                (unsigned long long)e->hash);
+        valid += e->readable && e->verdict == REPLAY_VALID;
+        total_ticks += e->ticks;
+        free(e->name);
+    }
+    fclose(out);
+    free(job.entries);
+
+    printf("%d replays vérifiés en %.2f s avec %d threads (%.0f replays/s, %.2f M ticks/s) : %d valides, %d rejetés\n",
+           job.count, seconds, threads, seconds > 0 ? job.count / seconds : 0.0, seconds > 0 ? total_ticks / seconds / 1e6 : 0.0,
+           valid, job.count - valid);
+    printf("Résultats : %s\n", out_path);
+    return valid == job.count ? 0 : 1;
+}
@@ -0,0 +1,188 @@
+/**
+ * @file wave_compiler.c
+ * @brief Outil de build : compile la description texte des niveaux en table binaire (voir src/waves.h).
+ * @details Usage : wave_compiler <niveaux.txt> <sortie.bin>
+ *          Syntaxe (une directive par ligne, '#' commente la fin de ligne) :
+ *            type <id> points <n> fire <facteur>          type d'ennemi (id de 0 à WAVES_MAX_TYPES - 1)
+ *            level [speed f] [fire f] [spacing dx dy] [origin x y]
+ *              <rangées>                                 un chiffre par case (type), '.' pour une case vide
+ *            end                                          termine la formation
+ *            repeat <n> [speed +f] [fire +f]              n copies du niveau précédent (même formation),
+ *                                                         facteurs augmentés à chaque copie
+ *          Sans origin, la formation est centrée horizontalement (y = 50). Les formations sont vérifiées :
+ *          au plus MAX_ENEMIES ennemis, entièrement à l'écran et au-dessus de la ligne du joueur.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "waves.h"
+
+#define MAX_LEVELS 4096
+#define MAX_ROWS 32
+#define MAX_COLS 64
+#define DANGER_Y (GAME_HEIGHT - 60 - 50) // Ligne de game over du modèle (joueur à GAME_HEIGHT - 60)
+
+static WaveEnemyType types[WAVES_MAX_TYPES];
+static int type_defined[WAVES_MAX_TYPES];
+static WaveLevel levels[MAX_LEVELS];
+static int level_count = 0;
+static Enemy* enemies = NULL;
+static uint32_t enemy_total = 0, enemy_capacity = 0;
+static const char* source = NULL;
+
+static int fail(int line, const char* message) {
+    fprintf(stderr, "%s:%d : %s\n", source, line, message);
+    return 0;
+}
+
+static int add_enemy(float x, float y, int type) {
+    if (enemy_total == enemy_capacity) {
+        enemy_capacity = enemy_capacity ? enemy_capacity * 2 : 1024;
+        Enemy* grown = realloc(enemies, enemy_capacity * sizeof(Enemy));
+        if (!grown) return 0;
+        enemies = grown;
+    }
+    enemies[enemy_total++] = (Enemy){ { x, y }, type, 1, { 0 } };
+    return 1;
+}
+
+/**
+ * @brief Place les rangées d'une formation et ajoute le niveau.
+ */
+static int build_level(int line, WaveLevel* level, char rows[][MAX_COLS + 1], int row_count, int dx, int dy, int has_origin, int ox, int oy) {
+    int cols = 0;
+    for (int r = 0; r < row_count; r++) if ((int)strlen(rows[r]) > cols) cols = (int)strlen(rows[r]);
+    if (!has_origin) { ox = (GAME_WIDTH - (cols - 1) * dx) / 2; oy = 50; }
+    level->first_enemy = enemy_total;
+    level->enemy_count = 0;
+    for (int r = 0; r < row_count; r++) {
+        for (int c = 0; rows[r][c]; c++) {
+            if (rows[r][c] == '.') continue;
+            int type = rows[r][c] - '0';
+            if (!type_defined[type]) return fail(line, "type d'ennemi non déclaré");
+            float x = ox + c * dx, y = oy + r * dy;
+            if (x <= 0 || x >= GAME_WIDTH - ENEMY_W || y < 0 || y + ENEMY_H > DANGER_Y) return fail(line, "ennemi hors de l'écran ou sous la ligne du joueur");
+            if (!add_enemy(x, y, type)) return fail(line, "mémoire insuffisante");
+            level->enemy_count++;
+        }
+    }
+    if (level->enemy_count == 0) return fail(line, "formation vide");
+    if (level->enemy_count > MAX_ENEMIES) return fail(line, "formation trop grande (MAX_ENEMIES)");
+    return 1;
+}
+
+static int compile(FILE* in) {
+    char buffer[512];
+    int line = 0;
+    WaveLevel* level = NULL;       // Niveau en cours de lecture (entre level et end)
+    char rows[MAX_ROWS][MAX_COLS + 1];
+    int row_count = 0, dx = 60, dy = 50, has_origin = 0, ox = 0, oy = 0, level_line = 0;
+
+    while (fgets(buffer, sizeof(buffer), in)) {
+        line++;
+        char* hash = strchr(buffer, '#');
+        if (hash) *hash = '\0';
+        char* tokens[16];
+        int n = 0;
+        for (char* t = strtok(buffer, " \t\r\n"); t && n < 16; t = strtok(NULL, " \t\r\n")) tokens[n++] = t;
+        if (n == 0) continue;
+
+        if (level) {
+            if (strcmp(tokens[0], "end") == 0) {
+                if (!build_level(level_line, level, rows, row_count, dx, dy, has_origin, ox, oy)) return 0;
+                level_count++;
+                level = NULL;
+                continue;
+            }
+            if (n != 1 || row_count == MAX_ROWS || strlen(tokens[0]) > MAX_COLS) return fail(line, "rangée invalide (ou trop de rangées/colonnes)");
+            for (const char* p = tokens[0]; *p; p++) {
+                if (*p != '.' && !(isdigit((unsigned char)*p) && *p - '0' < WAVES_MAX_TYPES)) return fail(line, "case invalide (chiffre de type ou '.')");
+            }
+            strcpy(rows[row_count++], tokens[0]);
+        } else if (strcmp(tokens[0], "type") == 0) {
+            int id = n >= 2 ? atoi(tokens[1]) : -1;
+            if (id < 0 || id >= WAVES_MAX_TYPES) return fail(line, "identifiant de type invalide");
+            types[id] = (WaveEnemyType){ 10, 1.0f };
+            for (int i = 2; i + 1 < n; i += 2) {
+                if (strcmp(tokens[i], "points") == 0) types[id].points = atoi(tokens[i + 1]);
+                else if (strcmp(tokens[i], "fire") == 0) types[id].fire_scale = (float)atof(tokens[i + 1]);
+                else return fail(line, "attribut de type inconnu");
+            }
+            type_defined[id] = 1;
+        } else if (strcmp(tokens[0], "level") == 0) {
+            if (level_count == MAX_LEVELS) return fail(line, "trop de niveaux");
+            level = &levels[level_count];
+            *level = (WaveLevel){ 0, 0, 1.0f, 1.0f };
+            row_count = 0; dx = 60; dy = 50; has_origin = 0; level_line = line;
+            for (int i = 1; i < n; i++) {
+                if (strcmp(tokens[i], "speed") == 0 && i + 1 < n) level->speed_scale = (float)atof(tokens[++i]);
+                else if (strcmp(tokens[i], "fire") == 0 && i + 1 < n) level->fire_scale = (float)atof(tokens[++i]);
+                else if (strcmp(tokens[i], "spacing") == 0 && i + 2 < n) { dx = atoi(tokens[i + 1]); dy = atoi(tokens[i + 2]); i += 2; }
+                else if (strcmp(tokens[i], "origin") == 0 && i + 2 < n) { ox = atoi(tokens[i + 1]); oy = atoi(tokens[i + 2]); has_origin = 1; i += 2; }
+                else return fail(line, "attribut de niveau inconnu");
+            }
+            if (dx < ENEMY_W || dy < ENEMY_H) return fail(line, "espacement inférieur à la taille d'un ennemi");
+        } else if (strcmp(tokens[0], "repeat") == 0) {
+            int count = n >= 2 ? atoi(tokens[1]) : 0;
+            if (level_count == 0 || count <= 0) return fail(line, "repeat sans niveau précédent ou sans nombre");
+            float speed_step = 0, fire_step = 0;
+            for (int i = 2; i + 1 < n; i += 2) {
+                if (strcmp(tokens[i], "speed") == 0) speed_step = (float)atof(tokens[i + 1]);
+                else if (strcmp(tokens[i], "fire") == 0) fire_step = (float)atof(tokens[i + 1]);
+                else return fail(line, "attribut de repeat inconnu");
+            }
+            for (int k = 0; k < count; k++) {
+                if (level_count == MAX_LEVELS) return fail(line, "trop de niveaux");
+                levels[level_count] = levels[level_count - 1]; // Même formation : rien n'est dupliqué
+                levels[level_count].speed_scale += speed_step;
+                levels[level_count].fire_scale += fire_step;
+                level_count++;
+            }
+        } else {
+            return fail(line, "directive inconnue");
+        }
+    }
+    if (level) return fail(line, "formation sans end");
+    if (level_count == 0) return fail(line, "aucun niveau");
+    return 1;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc != 3) {
+        fprintf(stderr, "Usage : %s <niveaux.txt> <sortie.bin>\n", argv[0]);
+        return 1;
+    }
+    source = argv[1];
+    FILE* in = fopen(argv[1], "r");
+    if (!in) { perror(argv[1]); return 1; }
+    int ok = compile(in);
+    fclose(in);
+    if (!ok) return 1;
+
+    int type_count = 0;
+    for (int i = 0; i < WAVES_MAX_TYPES; i++) if (type_defined[i]) type_count = i + 1;
+    WaveFileHeader header = { WAVES_MAGIC, WAVES_VERSION, sizeof(Enemy), (uint32_t)type_count, (uint32_t)level_count, enemy_total, 0 };
+    header.hash = fnv1a(FNV1A_OFFSET, types, type_count * sizeof(WaveEnemyType));
+    header.hash = fnv1a(header.hash, levels, level_count * sizeof(WaveLevel));
+    header.hash = fnv1a(header.hash, enemies, enemy_total * sizeof(Enemy));
+
+    size_t size = sizeof(header) + type_count * sizeof(WaveEnemyType) + level_count * sizeof(WaveLevel) + enemy_total * sizeof(Enemy);
+    unsigned char* table = malloc(size);
+    if (!table) return 1;
+    unsigned char* p = table;
+    memcpy(p, &header, sizeof(header)); p += sizeof(header);
+    memcpy(p, types, type_count * sizeof(WaveEnemyType)); p += type_count * sizeof(WaveEnemyType);
+    memcpy(p, levels, level_count * sizeof(WaveLevel)); p += level_count * sizeof(WaveLevel);
+    memcpy(p, enemies, enemy_total * sizeof(Enemy));
+    if (!waves_set(table, size)) { fprintf(stderr, "Table produite invalide\n"); return 1; } // Même contrôle qu'au chargement
+
+    FILE* out = fopen(argv[2], "wb");
+    if (!out || fwrite(table, 1, size, out) != size) { fprintf(stderr, "Impossible d'écrire %s\n", argv[2]); return 1; }
+    fclose(out);
+    printf("Niveaux %s : %d niveaux, %d types, %u ennemis, %zu octets\n", argv[2], level_count, type_count, enemy_total, size);
+    free(table);
+    free(enemies);
+    return 0;
+}